@@ -237,6 +237,8 @@ struct AObject {
     struct {
       struct {
         uint8_t on_leak_check_ : 1;
+        // freed but kept in ObjectCache, in_use_ is still set for ObjectSet
+        uint8_t in_obj_cache_ : 1;
       };
     };
   };
@@ -113,6 +113,7 @@ void *ObMallocAllocator::realloc(
     abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE
                  || obj->MAGIC_CODE_ == BIG_AOBJECT_MAGIC_CODE);
     abort_unless(obj->in_use_);
+    abort_unless(!obj->in_obj_cache_);
 
     get_mem_leak_checker().on_free(*obj);
   }
@@ -151,6 +152,7 @@ void ObMallocAllocator::free(void *ptr)
     abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE
                  || obj->MAGIC_CODE_ == BIG_AOBJECT_MAGIC_CODE);
     abort_unless(obj->in_use_);
+    abort_unless(!obj->in_obj_cache_);
     SANITY_POISON(obj->data_, obj->alloc_bytes_);
 
     get_mem_leak_checker().on_free(*obj);
@@ -27,6 +27,8 @@ using namespace oceanbase::common;
 void ObTenantCtxAllocator::set_tenant_deleted()
 {
   ATOMIC_STORE(&has_deleted_, true);
+  // objects of a deleted tenant must not stay pinned in thread caches
+  obj_mgr_.disable_obj_cache();
   set_idle(0);
 }
 
@@ -78,6 +80,7 @@ void* ObTenantCtxAllocator::realloc(const void *ptr, const int64_t size, const O
     obj = reinterpret_cast<AObject*>((char*)ptr - AOBJECT_HEADER_SIZE);
     abort_unless(obj->is_valid());
     abort_unless(obj->in_use_);
+    abort_unless(!obj->in_obj_cache_);
     abort_unless(obj->block()->is_valid());
     abort_unless(obj->block()->in_use_);
     SANITY_POISON(obj->data_, obj->alloc_bytes_);
@@ -114,6 +117,7 @@ void ObTenantCtxAllocator::free(void *ptr)
     abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE
                  || obj->MAGIC_CODE_ == BIG_AOBJECT_MAGIC_CODE);
     abort_unless(obj->in_use_);
+    abort_unless(!obj->in_obj_cache_);
     SANITY_POISON(obj->data_, obj->alloc_bytes_);
     obj_mgr_.free_object(obj);
   }
@@ -17,6 +17,245 @@
 using namespace oceanbase;
 using namespace lib;
 
+namespace
+{
+enum ObjectCacheState
+{
+  OBJ_CACHE_UNINIT = 0,
+  OBJ_CACHE_INITING,
+  OBJ_CACHE_READY,
+  OBJ_CACHE_EXITED
+};
+__thread ObjectCache tl_obj_cache;
+__thread int tl_obj_cache_state = OBJ_CACHE_UNINIT;
+
+struct ObjectCacheGuard
+{
+  ~ObjectCacheGuard()
+  {
+    tl_obj_cache_state = OBJ_CACHE_EXITED;
+    tl_obj_cache.flush_all();
+    tl_obj_cache.unlink();
+  }
+};
+} // end of anonymous namespace
+
+#ifndef ENABLE_SANITY
+bool ObjectCache::enable_ = true;
+#else
+bool ObjectCache::enable_ = false;
+#endif
+const char *const ObjectCache::CACHED_LABEL = "ObjectCache";
+ObjectCache *ObjectCache::head_ = nullptr;
+int32_t ObjectCache::list_lock_ = 0;
+
+ObjectCache *ObjectCache::get_instance()
+{
+  ObjectCache *cache = nullptr;
+  if (OB_LIKELY(OBJ_CACHE_READY == tl_obj_cache_state)) {
+    cache = is_enabled() ? &tl_obj_cache : nullptr;
+  } else if (OBJ_CACHE_UNINIT == tl_obj_cache_state && is_enabled()) {
+    // registering the thread exit callback may malloc and reenter here,
+    // the INITING state keeps the reentrant call away from the cache.
+    tl_obj_cache_state = OBJ_CACHE_INITING;
+    static thread_local ObjectCacheGuard guard;
+    UNUSED(guard);
+    tl_obj_cache.link();
+    tl_obj_cache_state = OBJ_CACHE_READY;
+    cache = &tl_obj_cache;
+  }
+  return cache;
+}
+
+void ObjectCache::flush_all_threads(ObjectMgr &owner)
+{
+  lock(list_lock_);
+  for (ObjectCache *cache = head_; OB_NOT_NULL(cache); cache = cache->next_) {
+    for (int64_t i = 0; i < SLOT_CNT; i++) {
+      // the owner must be checked under the slot lock: a push which has seen
+      // enable_obj_cache_ before it is cleared publishes the owner later under
+      // the same lock, the slot would be skipped if the owner were read before.
+      Slot &slot = cache->slots_[i];
+      lock(slot.lock_);
+      if (&owner == cache->owners_[i]) {
+        cache->flush_slot(i);
+      }
+      unlock(slot.lock_);
+    }
+  }
+  unlock(list_lock_);
+}
+
+AObject *ObjectCache::pop(ObjectMgr &owner, const uint64_t size)
+{
+  AObject *obj = nullptr;
+  int64_t idx = -1;
+  if (size > 0 && size <= MAX_CACHE_OBJ_SIZE && -1 != (idx = find_slot(owner))) {
+    Slot &slot = slots_[idx];
+    lock(slot.lock_);
+    // the slot may have been flushed by another thread in the meantime
+    if (&owner == owners_[idx]) {
+      Bin &bin = slot.bins_[(size - 1) / BIN_SIZE];
+      AObject *prev = nullptr;
+      AObject *cur = bin.head_;
+      // only an object of the same size is reused, so alloc_bytes_ of ObjectSet stays accurate
+      while (OB_NOT_NULL(cur) && cur->alloc_bytes_ != size) {
+        prev = cur;
+        cur = cur->next_;
+      }
+      if (OB_NOT_NULL(cur)) {
+        if (OB_ISNULL(prev)) {
+          bin.head_ = cur->next_;
+        } else {
+          prev->next_ = cur->next_;
+        }
+        bin.cnt_--;
+        const int64_t hold = cur->nobjs_ * AOBJECT_CELL_BYTES;
+        slot.hold_ -= hold;
+        ATOMIC_SAF(&hold_, hold);
+        slot.last_use_ = ++tick_;
+        abort_unless(cur->in_obj_cache_);
+        cur->in_obj_cache_ = false;
+        obj = cur;
+      }
+    }
+    unlock(slot.lock_);
+  }
+  return obj;
+}
+
+bool ObjectCache::push(ObjectMgr &owner, AObject *obj)
+{
+  bool bret = false;
+  const uint64_t size = obj->alloc_bytes_;
+  if (AOBJECT_MAGIC_CODE == obj->MAGIC_CODE_ && size > 0 && size <= MAX_CACHE_OBJ_SIZE) {
+    // freeing an object which is already cached
+    abort_unless(!obj->in_obj_cache_);
+    abort_unless(
+        AOBJECT_TAIL_MAGIC_CODE
+        == reinterpret_cast<uint64_t&>(obj->data_[obj->alloc_bytes_]));
+    const int64_t hold = obj->nobjs_ * AOBJECT_CELL_BYTES;
+    int64_t idx = find_slot(owner);
+    if (-1 == idx) {
+      idx = choose_slot();
+    }
+    Slot &slot = slots_[idx];
+    lock(slot.lock_);
+    if (!ATOMIC_LOAD(&owner.enable_obj_cache_)) {
+      // the owner is going away, its cached objects are being taken back
+    } else {
+      if (&owner != owners_[idx]) {
+        if (OB_NOT_NULL(owners_[idx])) {
+          flush_slot(idx);
+        }
+        ATOMIC_STORE(&owners_[idx], &owner);
+      }
+      Bin &bin = slot.bins_[(size - 1) / BIN_SIZE];
+      if (bin.cnt_ < MAX_BIN_OBJ_CNT && slot.hold_ + hold <= MAX_SLOT_HOLD
+          && ATOMIC_LOAD(&hold_) + hold <= MAX_HOLD) {
+        STRNCPY(&obj->label_[0], CACHED_LABEL, sizeof(obj->label_));
+        obj->label_[sizeof(obj->label_) - 1] = '\0';
+        obj->in_obj_cache_ = true;
+        obj->next_ = bin.head_;
+        bin.head_ = obj;
+        bin.cnt_++;
+        slot.hold_ += hold;
+        ATOMIC_AAF(&hold_, hold);
+        bret = true;
+      }
+      slot.last_use_ = ++tick_;
+    }
+    unlock(slot.lock_);
+  }
+  return bret;
+}
+
+void ObjectCache::flush(ObjectMgr &owner)
+{
+  const int64_t idx = find_slot(owner);
+  if (-1 != idx) {
+    Slot &slot = slots_[idx];
+    lock(slot.lock_);
+    if (&owner == owners_[idx]) {
+      flush_slot(idx);
+    }
+    unlock(slot.lock_);
+  }
+}
+
+void ObjectCache::flush_all()
+{
+  for (int64_t i = 0; i < SLOT_CNT; i++) {
+    Slot &slot = slots_[i];
+    lock(slot.lock_);
+    flush_slot(i);
+    unlock(slot.lock_);
+  }
+}
+
+int64_t ObjectCache::choose_slot() const
+{
+  int64_t idx = 0;
+  for (int64_t i = 0; i < SLOT_CNT; i++) {
+    if (OB_ISNULL(ATOMIC_LOAD(&owners_[i]))) {
+      idx = i;
+      break;
+    } else if (slots_[i].last_use_ < slots_[idx].last_use_) {
+      idx = i;
+    }
+  }
+  return idx;
+}
+
+void ObjectCache::flush_slot(const int64_t idx)
+{
+  Slot &slot = slots_[idx];
+  ObjectMgr *owner = owners_[idx];
+  if (OB_NOT_NULL(owner)) {
+    for (int64_t i = 0; i < BIN_CNT; i++) {
+      Bin &bin = slot.bins_[i];
+      while (OB_NOT_NULL(bin.head_)) {
+        AObject *obj = bin.head_;
+        bin.head_ = obj->next_;
+        obj->in_obj_cache_ = false;
+        owner->do_free_object(obj);
+      }
+      bin.cnt_ = 0;
+    }
+    ATOMIC_SAF(&hold_, slot.hold_);
+    slot.hold_ = 0;
+    ATOMIC_STORE(&owners_[idx], nullptr);
+  }
+}
+
+void ObjectCache::link()
+{
+  lock(list_lock_);
+  prev_ = nullptr;
+  next_ = head_;
+  if (OB_NOT_NULL(head_)) {
+    head_->prev_ = this;
+  }
+  head_ = this;
+  unlock(list_lock_);
+}
+
+void ObjectCache::unlink()
+{
+  lock(list_lock_);
+  if (OB_NOT_NULL(prev_)) {
+    prev_->next_ = next_;
+  } else if (this == head_) {
+    head_ = next_;
+  }
+  if (OB_NOT_NULL(next_)) {
+    next_->prev_ = prev_;
+  }
+  prev_ = nullptr;
+  next_ = nullptr;
+  unlock(list_lock_);
+}
+
 SubObjectMgr::SubObjectMgr(const bool for_logger)
   : mutex_(common::ObLatchIds::ALLOC_OBJECT_LOCK),
     normal_locker_(mutex_), logger_locker_(mutex_),
@@ -63,7 +302,9 @@ ObjectMgr::ObjectMgr(ObTenantCtxAllocator &allocator, uint64_t tenant_id, uint64
   : ta_(allocator), attr_(tenant_id, nullptr, ctx_id),
     sub_cnt_(1),
     root_mgr_(common::ObCtxIds::LOGGER_CTX_ID == attr_.ctx_id_),
-    last_wash_ts_(0), last_washed_size_(0)
+    last_wash_ts_(0), last_washed_size_(0),
+    enable_obj_cache_(common::ObCtxIds::LOGGER_CTX_ID != ctx_id
+                      && common::ObCtxIds::LIBEASY != ctx_id)
 {
   root_mgr_.set_tenant_ctx_allocator(allocator, attr_);
   MEMSET(sub_mgrs_, 0, sizeof(sub_mgrs_));
@@ -76,6 +317,7 @@ ObjectMgr::~ObjectMgr()
 }
 
 void ObjectMgr::reset() {
+  disable_obj_cache();
   for (int i = 1; i < ATOMIC_LOAD(&sub_cnt_); i++) {
     if (sub_mgrs_[i] != nullptr) {
       destroy_sub_mgr(sub_mgrs_[i]);
@@ -88,6 +330,18 @@ void ObjectMgr::reset() {
 AObject *ObjectMgr::alloc_object(uint64_t size, const ObMemAttr &attr)
 {
   AObject *obj = NULL;
+  ObjectCache *cache = nullptr;
+  if (ATOMIC_LOAD(&enable_obj_cache_) && OB_NOT_NULL(cache = ObjectCache::get_instance())
+      && OB_NOT_NULL(obj = cache->pop(*this, size))) {
+    abort_unless(obj->in_use_);
+    reinterpret_cast<uint64_t&>(obj->data_[size]) = AOBJECT_TAIL_MAGIC_CODE;
+    if (attr.label_.str_ != nullptr) {
+      STRNCPY(&obj->label_[0], attr.label_.str_, sizeof(obj->label_));
+      obj->label_[sizeof(obj->label_) - 1] = '\0';
+    } else {
+      obj->label_[0] = '\0';
+    }
+  }
   const uint64_t start = common::get_itid();
   SubObjectMgr *sub_mgr = nullptr;
   for (uint64_t i = 0; NULL == obj && i < ATOMIC_LOAD(&sub_cnt_); i++) {
@@ -152,6 +406,17 @@ AObject *ObjectMgr::realloc_object(
 }
 
 void ObjectMgr::free_object(AObject *obj)
+{
+  ObjectCache *cache = nullptr;
+  if (ATOMIC_LOAD(&enable_obj_cache_) && OB_NOT_NULL(cache = ObjectCache::get_instance())
+      && cache->push(*this, obj)) {
+    // cached, flushed back to its object set later
+  } else {
+    do_free_object(obj);
+  }
+}
+
+void ObjectMgr::do_free_object(AObject *obj)
 {
   ABlock *block = obj->block();
   abort_unless(block->is_valid());
@@ -251,6 +516,10 @@ void ObjectMgr::destroy_sub_mgr(SubObjectMgr *sub_mgr)
 int64_t ObjectMgr::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
+  ObjectCache *cache = nullptr;
+  if (ATOMIC_LOAD(&enable_obj_cache_) && OB_NOT_NULL(cache = ObjectCache::get_instance())) {
+    cache->flush(*this);
+  }
   const uint64_t start = common::get_itid();
   for (uint64_t i = 0; washed_size < wash_size && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
@@ -268,6 +537,15 @@ int64_t ObjectMgr::sync_wash(int64_t wash_size)
   return washed_size;
 }
 
+void ObjectMgr::disable_obj_cache()
+{
+  if (ATOMIC_LOAD(&enable_obj_cache_)) {
+    // objects pushed after this are not cached, see ObjectCache::push
+    ATOMIC_STORE(&enable_obj_cache_, false);
+    ObjectCache::flush_all_threads(*this);
+  }
+}
+
 ObjectMgr::Stat ObjectMgr::get_stat()
 {
   int64_t hold, payload, used;
@@ -76,8 +76,91 @@ private:
   ObjectSet os_;
 };
 
+class ObjectMgr;
+// ObjectCache is a thread local magazine of recently freed small objects, it sits in front of
+// the sub object mgrs so that hot alloc/free pairs of the same size can skip the set lock.
+// Cached objects stay in use from the view of ObjectSet, so hold/used and the memory limit
+// only change when they are flushed back, which happens on overflow, owner eviction, wash and
+// thread exit. They are marked by in_obj_cache_ so that a double free is still caught.
+// Caches of all threads are linked so that an ObjectMgr going away can take its objects
+// back from every thread, the slot lock is only contended in that case.
+class ObjectCache
+{
+public:
+  static const int SLOT_CNT = 8;
+  static const int BIN_CNT = 32;
+  static const uint32_t BIN_SIZE = 16;
+  static const uint32_t MAX_CACHE_OBJ_SIZE = BIN_CNT * BIN_SIZE;
+  static const int MAX_BIN_OBJ_CNT = 8;
+  static const int64_t MAX_SLOT_HOLD = 16L << 10;
+  // of all slots, more slots only avoid thrashing between tenants, not hold more memory
+  static const int64_t MAX_HOLD = 64L << 10;
+  static const char *const CACHED_LABEL;
+public:
+  static ObjectCache *get_instance();
+  static void set_enable(const bool enable) { ATOMIC_STORE(&enable_, enable); }
+  static bool is_enabled() { return ATOMIC_LOAD(&enable_); }
+  // flush objects of owner cached by all threads
+  static void flush_all_threads(ObjectMgr &owner);
+  AObject *pop(ObjectMgr &owner, const uint64_t size);
+  bool push(ObjectMgr &owner, AObject *obj);
+  // flush objects of owner cached by this thread
+  void flush(ObjectMgr &owner);
+  void flush_all();
+private:
+  struct Bin
+  {
+    AObject *head_;
+    int32_t cnt_;
+  };
+  struct Slot
+  {
+    int32_t lock_;
+    int64_t hold_;
+    int64_t last_use_;
+    Bin bins_[BIN_CNT];
+  };
+  OB_INLINE static void lock(int32_t &lock)
+  {
+    while (!ATOMIC_BCAS(&lock, 0, 1)) {
+      PAUSE();
+    }
+  }
+  OB_INLINE static void unlock(int32_t &lock) { ATOMIC_STORE(&lock, 0); }
+  OB_INLINE int64_t find_slot(const ObjectMgr &owner) const
+  {
+    int64_t idx = -1;
+    for (int64_t i = 0; -1 == idx && i < SLOT_CNT; i++) {
+      if (&owner == ATOMIC_LOAD(&owners_[i])) {
+        idx = i;
+      }
+    }
+    return idx;
+  }
+  // pick an empty slot, or the least recently used one
+  int64_t choose_slot() const;
+  // slot lock must be held
+  void flush_slot(const int64_t idx);
+  void link();
+  void unlink();
+private:
+  static bool enable_;
+  static ObjectCache *head_;
+  static int32_t list_lock_;
+  // POD on purpose, it lives in a __thread variable
+  // owners are kept apart from slots so that looking up an owner touches one cache line,
+  // they are changed with the slot lock held.
+  ObjectMgr *owners_[SLOT_CNT];
+  Slot slots_[SLOT_CNT];
+  int64_t hold_;
+  int64_t tick_;
+  ObjectCache *prev_;
+  ObjectCache *next_;
+};
+
 class ObjectMgr : public IBlockMgr
 {
+  friend class ObjectCache;
   static const int N = 32;
 public:
   struct Stat
@@ -107,10 +190,13 @@ public:
 
   void print_usage() const;
   int64_t sync_wash(int64_t wash_size) override;
+  // stop caching objects of this mgr and take back the cached ones from all threads
+  void disable_obj_cache();
   Stat get_stat();
 private:
   SubObjectMgr *create_sub_mgr();
   void destroy_sub_mgr(SubObjectMgr *sub_mgr);
+  void do_free_object(AObject *obj);
 
 public:
   ObTenantCtxAllocator &ta_;
@@ -120,6 +206,9 @@ public:
   SubObjectMgr *sub_mgrs_[N];
   int64_t last_wash_ts_;
   int64_t last_washed_size_;
+  // logger and libeasy have their own free path, object cache is not used for them,
+  // it is also turned off when the tenant is deleted
+  bool enable_obj_cache_;
 }; // end of class ObjectMgr
 
 } // end of namespace lib
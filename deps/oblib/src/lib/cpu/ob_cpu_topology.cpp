@@ -26,6 +26,128 @@ int64_t __attribute__((weak)) get_cpu_count()
 {
   return get_cpu_num();
 }
+
+class ObNumaTopology
+{
+public:
+  static const int64_t MAX_NUMA_NODE_COUNT = 64;
+  ObNumaTopology() : node_count_(0)
+  {
+    CPU_ZERO(&all_cpus_);
+    for (int64_t node = 0; node < MAX_NUMA_NODE_COUNT; node++) {
+      CPU_ZERO(&node_cpus_[node]);
+      if (!load_node_cpus_(node, node_cpus_[node])) {
+        break;
+      } else {
+        CPU_OR(&all_cpus_, &all_cpus_, &node_cpus_[node]);
+        node_count_++;
+      }
+    }
+    if (0 == node_count_) {
+      // no numa information, all cpus belong to node 0
+      for (int64_t cpu = 0; cpu < get_cpu_num() && cpu < CPU_SETSIZE; cpu++) {
+        CPU_SET(cpu, &all_cpus_);
+      }
+      node_cpus_[0] = all_cpus_;
+      node_count_ = 1;
+    }
+  }
+  static ObNumaTopology &get_instance()
+  {
+    static ObNumaTopology instance;
+    return instance;
+  }
+  int64_t get_node_count() const { return node_count_; }
+  const cpu_set_t &get_node_cpus(const int64_t node) const { return node_cpus_[node]; }
+private:
+  // the format of cpulist is like "0-15,32-47"
+  static bool load_node_cpus_(const int64_t node, cpu_set_t &cpu_set)
+  {
+    bool bret = false;
+    char path[64];
+    char buf[1024];
+    FILE *file = NULL;
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%ld/cpulist", node);
+    if (NULL != (file = fopen(path, "r"))) {
+      if (NULL != fgets(buf, sizeof(buf), file)) {
+        char *save_ptr = NULL;
+        char *range = strtok_r(buf, ",\n", &save_ptr);
+        while (NULL != range) {
+          int64_t begin = 0;
+          int64_t end = 0;
+          const int cnt = sscanf(range, "%ld-%ld", &begin, &end);
+          if (1 == cnt) {
+            end = begin;
+          }
+          for (int64_t cpu = begin; cnt >= 1 && cpu <= end && cpu < CPU_SETSIZE; cpu++) {
+            CPU_SET(cpu, &cpu_set);
+          }
+          range = strtok_r(NULL, ",\n", &save_ptr);
+        }
+        // node without cpu (e.g. memory only node) is ignored
+        bret = CPU_COUNT(&cpu_set) > 0;
+      }
+      fclose(file);
+    }
+    return bret;
+  }
+private:
+  int64_t node_count_;
+  cpu_set_t node_cpus_[MAX_NUMA_NODE_COUNT];
+  cpu_set_t all_cpus_;
+};
+
+int64_t get_numa_node_count()
+{
+  return ObNumaTopology::get_instance().get_node_count();
+}
+
+int get_numa_node_cpus(const int64_t node, cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  ObNumaTopology &topology = ObNumaTopology::get_instance();
+  if (OB_UNLIKELY(node < 0 || node >= topology.get_node_count())) {
+    ret = OB_INVALID_ARGUMENT;
+  } else {
+    cpu_set = topology.get_node_cpus(node);
+  }
+  return ret;
+}
+
+int get_thread_cpu_affinity(cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  CPU_ZERO(&cpu_set);
+  if (0 != pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set)) {
+    ret = OB_ERR_SYS;
+  }
+  return ret;
+}
+
+int set_thread_cpu_affinity(const cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  if (0 != pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set)) {
+    ret = OB_ERR_SYS;
+  }
+  return ret;
+}
+
+int bind_thread_to_numa_node(const int64_t node, const cpu_set_t &allowed_cpu_set)
+{
+  int ret = OB_SUCCESS;
+  cpu_set_t cpu_set;
+  if (OB_FAIL(get_numa_node_cpus(node, cpu_set))) {
+    // invalid node
+  } else if (FALSE_IT(CPU_AND(&cpu_set, &cpu_set, &allowed_cpu_set))) {
+  } else if (0 == CPU_COUNT(&cpu_set)) {
+    // none of the cpus of the node is allowed, e.g. excluded by cpuset cgroup
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_FAIL(set_thread_cpu_affinity(cpu_set))) {
+    // set affinity failed
+  }
+  return ret;
+}
 } // common
 } // oceanbase
 
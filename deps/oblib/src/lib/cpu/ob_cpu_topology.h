@@ -14,6 +14,7 @@
 #define OCEANBASE_LIB_OB_CPU_TOPOLOGY_
 
 #include <stdint.h>
+#include <sched.h>
 #include "lib/utility/ob_macro_utils.h"
 #include "lib/utility/utility.h"
 
@@ -22,6 +23,16 @@ namespace oceanbase
 namespace common
 {
 int64_t get_cpu_count();
+
+// NUMA topology read from /sys/devices/system/node, a host without NUMA
+// information is regarded as one node which contains all cpus.
+int64_t get_numa_node_count();
+int get_numa_node_cpus(const int64_t node, cpu_set_t &cpu_set);
+int get_thread_cpu_affinity(cpu_set_t &cpu_set);
+int set_thread_cpu_affinity(const cpu_set_t &cpu_set);
+// bind current thread to the cpus of the node which are also in allowed_cpu_set,
+// return OB_ENTRY_NOT_EXIST if there is no such cpu
+int bind_thread_to_numa_node(const int64_t node, const cpu_set_t &allowed_cpu_set);
 } // namespace common
 } // namespace oceanbase
 
@@ -41,6 +41,7 @@ ObBaseLogWriter::ObBaseLogWriter()
     max_buffer_item_cnt_(0),
     log_item_push_idx_(0),
     log_item_pop_idx_(0),
+    append_wait_cnt_(0),
     log_write_cond_(nullptr),
     log_flush_cond_(nullptr)
 {
@@ -208,6 +209,7 @@ int ObBaseLogWriter::append_log(ObIBaseLogItem &log_item, const uint64_t timeout
     LOG_STDERR("The ObBaseLogWriter has not been inited.\n");
   } else {
     int64_t abs_time = ObTimeUtility::current_time() + timeout_us;
+    bool waited = false;
     while (OB_SUCC(ret)) {
       auto key = log_write_cond_->get_key();
       int64_t push_idx = ATOMIC_LOAD(&log_item_push_idx_);
@@ -227,6 +229,10 @@ int ObBaseLogWriter::append_log(ObIBaseLogItem &log_item, const uint64_t timeout
         } else if (current_time >= abs_time && timeout_us != UINT64_MAX) {
           ret = OB_TIMEOUT;
         } else {
+          if (!waited) {
+            waited = true;
+            IGNORE_RETURN ATOMIC_AAF(&append_wait_cnt_, 1);
+          }
           log_write_cond_->wait(key, abs_time - current_time);
         }
       }
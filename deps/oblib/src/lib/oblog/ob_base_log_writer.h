@@ -88,6 +88,8 @@ public:
   {
     return log_item_push_idx_ - log_item_pop_idx_;
   }
+  // count of append_log which had to wait for the full queue
+  int64_t get_append_wait_cnt() const { return append_wait_cnt_; }
 protected:
   void flush_log();
   virtual void process_log_items(ObIBaseLogItem **items, const int64_t item_cnt, int64_t &finish_cnt) = 0;
@@ -111,6 +113,7 @@ protected:
   uint64_t max_buffer_item_cnt_ CACHE_ALIGNED;
   int64_t log_item_push_idx_ CACHE_ALIGNED;
   int64_t log_item_pop_idx_ CACHE_ALIGNED;
+  int64_t append_wait_cnt_;
 
   pthread_mutex_t thread_mutex_;
 
@@ -459,8 +459,9 @@ ObLogger::ObLogger()
     disable_thread_log_level_(false), force_check_(false), redirect_flag_(false), open_wf_flag_(false),
     enable_wf_flag_(false), rec_old_file_flag_(false), can_print_(true),
     enable_async_log_(true), use_multi_flush_(false), stop_append_log_(false), enable_perf_mode_(false),
-    last_async_flush_count_per_sec_(0), log_mem_limiter_(nullptr),
-    allocator_(nullptr), error_allocator_(nullptr), enable_log_limit_(true)
+    last_async_flush_count_per_sec_(0), delayed_log_count_(0), log_mem_limiter_(nullptr),
+    allocator_(nullptr), error_allocator_(nullptr), enable_log_limit_(true),
+    enable_log_shedding_(false)
 {
   id_level_map_.set_level(OB_LOG_LEVEL_ERROR);
 
@@ -1674,6 +1675,9 @@ int ObLogger::alloc_log_item(const int32_t level, const int32_t size, ObPLogItem
       LOG_STDERR("uninit error, ret=%d, level=%d\n", ret, level);
     } else if (OB_UNLIKELY(nullptr == (buf = (char*)p_alloc->alloc(size)))) {
       int64_t wait_us = get_wait_us(level);
+      if (wait_us > 0) {
+        IGNORE_RETURN ATOMIC_AAF(&delayed_log_count_, 1);
+      }
       const int64_t per_us = MIN(wait_us, 10);
       while (wait_us > 0) {
         if (nullptr != (buf = (char*)p_alloc->alloc(size))) {
@@ -1710,6 +1714,118 @@ void ObLogger::free_log_item(ObPLogItem *log_item)
   }
 }
 
+// Rank of the par module when shedding logs. Logs of the availability path
+// (clog, election, rootserver ...) are kept longest, the noisy request path
+// modules are shed first.
+enum ObLogShedRank
+{
+  LOG_SHED_FIRST = 0,
+  LOG_SHED_NORMAL = 1,
+  LOG_SHED_LAST = 2,
+};
+
+static int32_t get_log_shed_rank(const char *mod_name)
+{
+  struct ModShedRank
+  {
+    const char *name_;
+    int32_t rank_;
+  };
+  static const ModShedRank MOD_SHED_RANKS[] = {
+    {"SQL", LOG_SHED_FIRST},
+    {"PL", LOG_SHED_FIRST},
+    {"JIT", LOG_SHED_FIRST},
+    {"SERVER", LOG_SHED_FIRST},
+    {"CLIENT", LOG_SHED_FIRST},
+    {"RPC", LOG_SHED_FIRST},
+    {"EASY", LOG_SHED_FIRST},
+    {"REASY", LOG_SHED_FIRST},
+    {"LIB", LOG_SHED_FIRST},
+    {"COMMON", LOG_SHED_FIRST},
+    {"CLOG", LOG_SHED_LAST},
+    {"PALF", LOG_SHED_LAST},
+    {"ELECT", LOG_SHED_LAST},
+    {"COORDINATOR", LOG_SHED_LAST},
+    {"RS", LOG_SHED_LAST},
+    {"BOOTSTRAP", LOG_SHED_LAST},
+    {"STANDBY", LOG_SHED_LAST},
+    {"ARCHIVE", LOG_SHED_LAST},
+  };
+  int32_t rank = LOG_SHED_NORMAL;
+  // mod_name looks like "[PAR_MOD.SUB_MOD] " or "[PAR_MOD] "
+  if (OB_NOT_NULL(mod_name) && '[' == mod_name[0]) {
+    const char *par_mod = mod_name + 1;
+    int64_t len = 0;
+    while ('\0' != par_mod[len] && '.' != par_mod[len] && ']' != par_mod[len]) {
+      ++len;
+    }
+    for (int64_t i = 0; i < ARRAYSIZEOF(MOD_SHED_RANKS); ++i) {
+      if (len == static_cast<int64_t>(strlen(MOD_SHED_RANKS[i].name_))
+          && 0 == STRNCMP(par_mod, MOD_SHED_RANKS[i].name_, len)) {
+        rank = MOD_SHED_RANKS[i].rank_;
+        break;
+      }
+    }
+  }
+  return rank;
+}
+
+// Shed logs once the async queue gets congested, so that a log storm drops the
+// noise instead of making every logging thread wait on the full queue. Lower
+// level and lower ranked modules are shed first, user request logs a bit earlier
+// than others. error and force allowed logs are never shed here.
+bool ObLogger::need_shed_log(const char *mod_name, const int32_t level) const
+{
+  // no log is shed below it, see the adjustments below
+  static const int64_t MIN_SHED_PCT = 30;
+  bool bret = false;
+  if (!enable_log_shedding_ || level <= OB_LOG_LEVEL_ERROR || is_force_allows()
+      || 0 == max_buffer_item_cnt_) {
+    // never shed
+  } else {
+    const int64_t used_pct = get_queued_item_cnt() * 100 / static_cast<int64_t>(max_buffer_item_cnt_);
+    if (used_pct >= MIN_SHED_PCT) {
+      int64_t limit_pct = 0;
+      switch (level) {
+        case OB_LOG_LEVEL_WARN: {
+          limit_pct = 90;
+          break;
+        }
+        case OB_LOG_LEVEL_INFO: {
+          limit_pct = 75;
+          break;
+        }
+        case OB_LOG_LEVEL_TRACE: {
+          limit_pct = 60;
+          break;
+        }
+        default: {
+          limit_pct = 50;
+          break;
+        }
+      }
+      switch (get_log_shed_rank(mod_name)) {
+        case LOG_SHED_FIRST: {
+          limit_pct -= 10;
+          break;
+        }
+        case LOG_SHED_LAST: {
+          limit_pct += 5;
+          break;
+        }
+        default: {
+          break;
+        }
+      }
+      if (1 == tl_type_) { // user request
+        limit_pct -= 10;
+      }
+      bret = used_pct >= limit_pct;
+    }
+  }
+  return bret;
+}
+
 void ObLogger::inc_dropped_log_count(const int32_t level)
 {
   if (OB_LIKELY(level <= OB_LOG_LEVEL_DEBUG)
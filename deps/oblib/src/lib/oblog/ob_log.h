@@ -370,6 +370,7 @@ public:
   int64_t get_dropped_debug_log_count() const { return dropped_log_count_[LOG_DEBUG]; }
 
   int64_t get_async_flush_log_speed() const { return last_async_flush_count_per_sec_; }
+  int64_t get_delayed_log_count() const { return delayed_log_count_ + get_append_wait_cnt(); }
   bool enable_async_log() const { return enable_async_log_; }
   void set_enable_async_log(const bool flag) { enable_async_log_ = flag; }
   void set_stop_append_log() { stop_append_log_ = true; }
@@ -609,6 +610,7 @@ public:
   void set_enable_log_limit(bool enable_log_limit) {
     enable_log_limit_ = enable_log_limit;
   }
+  void set_enable_log_shedding(const bool flag) { enable_log_shedding_ = flag; }
 
   static void set_tl_limiter(::oceanbase::lib::ObRateLimiter &limiter)
   {
@@ -705,6 +707,7 @@ private:
   int alloc_log_item(const int32_t level, const int32_t size, ObPLogItem *&log_item);
   void free_log_item(ObPLogItem *log_item);
   void inc_dropped_log_count(const int32_t level);
+  bool need_shed_log(const char *mod_name, const int32_t level) const;
   template<typename Function>
   void do_log_message(const bool is_async,
                       const char *mod_name,
@@ -780,6 +783,8 @@ private:
   //used for statistics
   int64_t dropped_log_count_[LOG_MAX_LEVEL];
   int64_t last_async_flush_count_per_sec_;
+  // logs waited for log item memory
+  int64_t delayed_log_count_;
 
   int64_t dropped_count_[MAX_TASK_LOG_TYPE + 1];//last one is force allow count
   int64_t written_count_[MAX_TASK_LOG_TYPE + 1];
@@ -789,6 +794,8 @@ private:
   ObFIFOAllocator* error_allocator_;
   // juse use it for test promise log print
   bool enable_log_limit_;
+  // shed async logs under queue congestion, see need_shed_log
+  bool enable_log_shedding_;
   RLOCAL_STATIC(ByteBuf<LOCAL_BUF_SIZE>, local_buf_);
   struct {
     ProbeAction action_;
@@ -1144,6 +1151,9 @@ inline void ObLogger::do_log_message(const bool is_async,
     LOG_STDERR("precheck_tl_log_limiter error, ret=%d\n", ret);
   } else if (OB_UNLIKELY(!allow) && FD_TRACE_FILE != fd_type) {
     inc_dropped_log_count(level);
+  } else if (is_async && OB_UNLIKELY(need_shed_log(mod_name, level)) && FD_TRACE_FILE != fd_type) {
+    // drop before formatting, don't wait for the congested queue
+    inc_dropped_log_count(level);
   } else {
     ++curr_logging_seq_;
     // format to local buf
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+
+#include "lib/profile/ob_cpu_profiler.h"
+#include <sys/time.h>
+#include "lib/ash/ob_active_session_guard.h"
+#include "lib/hash_func/murmur_hash.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/profile/ob_trace_id.h"
+#include "lib/signal/ob_libunwind.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+int64_t ObCpuProfileEntry::print_folded_stack(char *buf, const int64_t buf_len) const
+{
+  int64_t pos = 0;
+  for (int64_t i = depth_ - 1; i >= 0; i--) {
+    if (OB_SUCCESS != databuff_printf(buf, buf_len, pos,
+                                      depth_ - 1 == i ? "0x%lx" : ";0x%lx", addrs_[i])) {
+      break;
+    }
+  }
+  return pos;
+}
+
+ObCpuProfiler::ObCpuProfiler()
+  : lock_(),
+    handler_installed_(false),
+    is_running_(false),
+    frequency_(0),
+    in_handler_cnt_(0),
+    sample_cnt_(0),
+    dropped_cnt_(0)
+{
+}
+
+ObCpuProfiler &ObCpuProfiler::get_instance()
+{
+  static ObCpuProfiler instance;
+  return instance;
+}
+
+int ObCpuProfiler::set_frequency(const int64_t frequency)
+{
+  int ret = OB_SUCCESS;
+  lib::ObMutexGuard guard(lock_);
+  if (OB_UNLIKELY(frequency < 0 || frequency > MAX_FREQUENCY)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid cpu profile frequency", K(ret), K(frequency));
+  } else if (frequency == frequency_) {
+    // do nothing
+  } else if (!handler_installed_ && OB_FAIL(install_handler())) {
+    LOG_WARN("install cpu profile handler failed", K(ret));
+  } else {
+    if (frequency_ > 0) {
+      ATOMIC_STORE(&is_running_, false);
+      IGNORE_RETURN set_timer(0);
+    }
+    if (frequency > 0) {
+      clear();
+      ATOMIC_STORE(&is_running_, true);
+      if (OB_FAIL(set_timer(frequency))) {
+        ATOMIC_STORE(&is_running_, false);
+        LOG_WARN("start cpu profile timer failed", K(ret), K(frequency));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      LOG_INFO("cpu profile frequency changed", "from", frequency_, "to", frequency,
+               K_(sample_cnt), K_(dropped_cnt));
+      frequency_ = frequency;
+    }
+  }
+  return ret;
+}
+
+const ObCpuProfileEntry *ObCpuProfiler::get_entry(const int64_t idx) const
+{
+  const ObCpuProfileEntry *entry = NULL;
+  if (idx >= 0 && idx < ENTRY_CNT && ATOMIC_LOAD(&entries_[idx].ready_)) {
+    entry = &entries_[idx];
+  }
+  return entry;
+}
+
+int ObCpuProfiler::install_handler()
+{
+  int ret = OB_SUCCESS;
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_sigaction = prof_handler;
+  sa.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  if (0 != sigaction(SIGPROF, &sa, NULL)) {
+    ret = OB_ERR_SYS;
+    LOG_WARN("install SIGPROF handler failed", K(ret), K(errno));
+  } else {
+    handler_installed_ = true;
+  }
+  return ret;
+}
+
+int ObCpuProfiler::set_timer(const int64_t frequency)
+{
+  int ret = OB_SUCCESS;
+  const int64_t interval_us = frequency > 0 ? 1000000 / frequency : 0;
+  struct itimerval timer;
+  timer.it_interval.tv_sec = interval_us / 1000000;
+  timer.it_interval.tv_usec = interval_us % 1000000;
+  timer.it_value = timer.it_interval;
+  if (0 != setitimer(ITIMER_PROF, &timer, NULL)) {
+    ret = OB_ERR_SYS;
+    LOG_WARN("setitimer failed", K(ret), K(errno), K(frequency));
+  }
+  return ret;
+}
+
+void ObCpuProfiler::clear()
+{
+  // wait for the handlers which have seen the previous running state
+  while (ATOMIC_LOAD(&in_handler_cnt_) > 0) {
+    PAUSE();
+  }
+  if (sample_cnt_ > 0) {
+    MEMSET(entries_, 0, sizeof(entries_));
+  }
+  sample_cnt_ = 0;
+  dropped_cnt_ = 0;
+}
+
+void ObCpuProfiler::prof_handler(int sig, siginfo_t *info, void *context)
+{
+  UNUSED(sig);
+  UNUSED(info);
+  UNUSED(context);
+  const int saved_errno = errno;
+  ObCpuProfiler &profiler = get_instance();
+  ATOMIC_INC(&profiler.in_handler_cnt_);
+  if (ATOMIC_LOAD(&profiler.is_running_)) {
+    profiler.sample();
+  }
+  ATOMIC_DEC(&profiler.in_handler_cnt_);
+  errno = saved_errno;
+}
+
+// called in signal handler, must be async signal safe
+void ObCpuProfiler::sample()
+{
+  uintptr_t addrs[ObCpuProfileEntry::MAX_DEPTH];
+  const int depth = safe_sig_backtrace(addrs, ObCpuProfileEntry::MAX_DEPTH);
+  ATOMIC_INC(&sample_cnt_);
+  if (depth <= 0) {
+    ATOMIC_INC(&dropped_cnt_);
+  } else {
+    const uint64_t tenant_id = ob_get_tenant_id();
+    const char *tname = ob_get_tname();
+    const char *sql_id = ObActiveSessionGuard::get_stat().sql_id_;
+    const int32_t tname_len = static_cast<int32_t>(strnlen(tname, OB_THREAD_NAME_BUF_LEN - 1));
+    const int32_t sql_id_len = static_cast<int32_t>(strnlen(sql_id, OB_MAX_SQL_ID_LENGTH));
+    uint64_t key = murmurhash(addrs, static_cast<int32_t>(depth * sizeof(addrs[0])), tenant_id);
+    key = murmurhash(tname, tname_len, key);
+    key = murmurhash(sql_id, sql_id_len, key);
+    key = 0 == key ? 1 : key;
+    bool found = false;
+    for (int64_t i = 0; !found && i < MAX_PROBE_CNT; i++) {
+      ObCpuProfileEntry &entry = entries_[(key + i) & (ENTRY_CNT - 1)];
+      uint64_t cur_key = ATOMIC_LOAD(&entry.key_);
+      if (0 == cur_key && 0 == (cur_key = ATOMIC_VCAS(&entry.key_, 0, key))) {
+        found = true;
+        entry.tenant_id_ = tenant_id;
+        entry.depth_ = depth;
+        MEMCPY(entry.addrs_, addrs, depth * sizeof(addrs[0]));
+        MEMCPY(entry.tname_, tname, tname_len);
+        entry.tname_[tname_len] = '\0';
+        MEMCPY(entry.sql_id_, sql_id, sql_id_len);
+        entry.sql_id_[sql_id_len] = '\0';
+        MEMCPY(entry.trace_id_, ObCurTraceId::get(), sizeof(entry.trace_id_));
+        ATOMIC_INC(&entry.count_);
+        ATOMIC_STORE(&entry.ready_, true);
+      } else if (cur_key == key) {
+        found = true;
+        ATOMIC_INC(&entry.count_);
+      }
+    }
+    if (!found) {
+      ATOMIC_INC(&dropped_cnt_);
+    }
+  }
+}
+
+} // namespace common
+} // namespace oceanbase
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_COMMON_OB_CPU_PROFILER_H_
+#define OCEANBASE_COMMON_OB_CPU_PROFILER_H_
+
+#include <signal.h>
+#include "lib/ob_define.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/lock/ob_mutex.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// samples of the same tenant, thread, sql and stack are aggregated into one entry,
+// keep it trivial so that the entries stay untouched in bss until used
+struct ObCpuProfileEntry
+{
+  static const int64_t MAX_DEPTH = 32;
+  uint64_t key_; // 0 means free
+  int64_t count_;
+  bool ready_; // other fields are filled
+  uint64_t tenant_id_;
+  int64_t depth_;
+  uintptr_t addrs_[MAX_DEPTH]; // leaf frame first
+  char tname_[OB_THREAD_NAME_BUF_LEN];
+  char sql_id_[OB_MAX_SQL_ID_LENGTH + 1];
+  uint64_t trace_id_[4]; // trace id of the first sample
+  // print stack as root;...;leaf, the folded format of flame graph
+  int64_t print_folded_stack(char *buf, const int64_t buf_len) const;
+};
+
+// On-CPU profiler based on ITIMER_PROF, which delivers SIGPROF to the thread
+// consuming cpu every 1/frequency second of process cpu time. The signal
+// handler walks the interrupted stack and aggregates it into a fixed size
+// lock free hash table, so sampling neither allocates nor locks.
+//
+// Samples are kept until the profiler is restarted, samples that can not
+// find a free entry are only counted as dropped.
+class ObCpuProfiler
+{
+public:
+  static const int64_t ENTRY_CNT = 1L << 14;
+  static const int64_t MAX_FREQUENCY = 1000;
+  static ObCpuProfiler &get_instance();
+  // 0 stops the profiler, a different frequency restarts it with empty samples
+  int set_frequency(const int64_t frequency);
+  int64_t get_frequency() const { return frequency_; }
+  int64_t get_sample_cnt() const { return ATOMIC_LOAD(&sample_cnt_); }
+  int64_t get_dropped_cnt() const { return ATOMIC_LOAD(&dropped_cnt_); }
+  // return NULL if the entry is not used
+  const ObCpuProfileEntry *get_entry(const int64_t idx) const;
+private:
+  static const int64_t MAX_PROBE_CNT = 16;
+  ObCpuProfiler();
+  ~ObCpuProfiler() = default;
+  static void prof_handler(int sig, siginfo_t *info, void *context);
+  int install_handler();
+  int set_timer(const int64_t frequency);
+  void clear();
+  void sample();
+private:
+  lib::ObMutex lock_;
+  bool handler_installed_;
+  bool is_running_;
+  int64_t frequency_;
+  int64_t in_handler_cnt_;
+  int64_t sample_cnt_;
+  int64_t dropped_cnt_;
+  ObCpuProfileEntry entries_[ENTRY_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObCpuProfiler);
+};
+
+} // namespace common
+} // namespace oceanbase
+
+#endif // OCEANBASE_COMMON_OB_CPU_PROFILER_H_
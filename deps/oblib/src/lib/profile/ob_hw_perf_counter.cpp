@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+
+#include "lib/profile/ob_hw_perf_counter.h"
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <string.h>
+#include "lib/atomic/ob_atomic.h"
+#include "lib/oblog/ob_log.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+ObHwPerfCounters::ObHwPerfCounters()
+  : is_inited_(false),
+    init_failed_(false)
+{
+  for (int64_t i = 0; i < MAX_COUNTER; i++) {
+    fds_[i] = -1;
+    pages_[i] = NULL;
+  }
+}
+
+ObHwPerfCounters::~ObHwPerfCounters()
+{
+  destroy();
+}
+
+ObHwPerfCounters *ObHwPerfCounters::get_thread_counters()
+{
+  static thread_local ObHwPerfCounters counters;
+  ObHwPerfCounters *ret_counters = NULL;
+  if (OB_LIKELY(counters.is_inited_)) {
+    ret_counters = &counters;
+  } else if (counters.init_failed_) {
+    // not available, don't retry
+  } else if (OB_SUCCESS != counters.init()) {
+    counters.init_failed_ = true;
+  } else {
+    ret_counters = &counters;
+  }
+  return ret_counters;
+}
+
+int ObHwPerfCounters::init()
+{
+  int ret = OB_SUCCESS;
+  static bool warned = false;
+  static const uint64_t configs[MAX_COUNTER] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES, // last level cache misses on most cpus
+    PERF_COUNT_HW_BRANCH_MISSES
+  };
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  for (int64_t i = 0; OB_SUCC(ret) && i < MAX_COUNTER; i++) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = configs[i];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fds_[i] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fds_[i] < 0) {
+      ret = OB_NOT_SUPPORTED;
+      if (!ATOMIC_LOAD(&warned) && ATOMIC_BCAS(&warned, false, true)) {
+        LOG_WARN("perf_event_open failed, hardware counters not available", K(ret), K(i), K(errno));
+      }
+    } else {
+      void *page = mmap(NULL, page_size, PROT_READ, MAP_SHARED, fds_[i], 0);
+      // read(2) is used if mmap failed
+      pages_[i] = MAP_FAILED == page ? NULL : static_cast<perf_event_mmap_page *>(page);
+    }
+  }
+  if (OB_FAIL(ret)) {
+    destroy();
+  } else {
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObHwPerfCounters::destroy()
+{
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  for (int64_t i = 0; i < MAX_COUNTER; i++) {
+    if (NULL != pages_[i]) {
+      munmap(pages_[i], page_size);
+      pages_[i] = NULL;
+    }
+    if (fds_[i] >= 0) {
+      close(fds_[i]);
+      fds_[i] = -1;
+    }
+  }
+  is_inited_ = false;
+}
+
+void ObHwPerfCounters::read(uint64_t (&values)[MAX_COUNTER]) const
+{
+  for (int64_t i = 0; i < MAX_COUNTER; i++) {
+    values[i] = read_counter(i);
+  }
+}
+
+uint64_t ObHwPerfCounters::read_counter(const int64_t idx) const
+{
+  uint64_t value = 0;
+  bool done = false;
+#if defined(__x86_64__)
+  const volatile perf_event_mmap_page *pc = pages_[idx];
+  if (NULL != pc && pc->cap_user_rdpmc) {
+    uint32_t seq = 0;
+    do {
+      seq = pc->lock;
+      __asm__ __volatile__("" ::: "memory");
+      const uint32_t index = pc->index;
+      int64_t count = pc->offset;
+      done = false;
+      if (0 != index) {
+        uint32_t low = 0;
+        uint32_t high = 0;
+        __asm__ __volatile__("rdpmc" : "=a"(low), "=d"(high) : "c"(index - 1));
+        const uint16_t width = pc->pmc_width;
+        int64_t pmc = static_cast<int64_t>((static_cast<uint64_t>(high) << 32) | low);
+        pmc <<= 64 - width;
+        pmc >>= 64 - width;
+        count += pmc;
+        done = true;
+      }
+      value = count;
+      __asm__ __volatile__("" ::: "memory");
+    } while (pc->lock != seq);
+  }
+#endif
+  if (!done) {
+    uint64_t count = 0;
+    if (sizeof(count) == ::read(fds_[idx], &count, sizeof(count))) {
+      value = count;
+    }
+  }
+  return value;
+}
+
+} // namespace common
+} // namespace oceanbase
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_COMMON_OB_HW_PERF_COUNTER_H_
+#define OCEANBASE_COMMON_OB_HW_PERF_COUNTER_H_
+
+#include <stdint.h>
+#include "lib/utility/ob_macro_utils.h"
+
+struct perf_event_mmap_page;
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Hardware counters of the calling thread, opened lazily by perf_event_open
+// with user space only events. Values are read by rdpmc from the mmapped
+// event page when the kernel allows it, otherwise by read(2).
+// Values are not scaled for multiplexing: if the kernel time-shares the PMU
+// among more events than it has counters, an event only counts while it is
+// scheduled and the value is lower than the real count.
+class ObHwPerfCounters
+{
+public:
+  enum CounterType
+  {
+    CPU_CYCLES = 0,
+    INSTRUCTIONS,
+    LLC_MISSES,
+    BRANCH_MISSES,
+    MAX_COUNTER
+  };
+  // NULL if hardware counters are not available on this thread
+  static ObHwPerfCounters *get_thread_counters();
+  // read the current values of all counters
+  void read(uint64_t (&values)[MAX_COUNTER]) const;
+private:
+  ObHwPerfCounters();
+  ~ObHwPerfCounters();
+  int init();
+  void destroy();
+  uint64_t read_counter(const int64_t idx) const;
+private:
+  bool is_inited_;
+  bool init_failed_;
+  int fds_[MAX_COUNTER];
+  perf_event_mmap_page *pages_[MAX_COUNTER];
+  DISALLOW_COPY_AND_ASSIGN(ObHwPerfCounters);
+};
+
+} // namespace common
+} // namespace oceanbase
+
+#endif // OCEANBASE_COMMON_OB_HW_PERF_COUNTER_H_
@@ -34,6 +34,32 @@ int safe_backtrace(char *buf, int64_t len, int64_t *pos)
   return ret;
 }
 
+int safe_sig_backtrace(uintptr_t *addrs, int64_t max_cnt)
+{
+  int ret = 0;
+  unw_context_t context;
+  unw_cursor_t cursor;
+  if (unw_getcontext(&context) < 0 || unw_init_local(&cursor, &context) < 0) {
+    ret = -1;
+  } else {
+    int in_handler = 1;
+    for (int i = 0; i < MAX_BT_ADDRESS_CNT && ret < max_cnt; i++) {
+      if (in_handler) {
+        // skip the frames of signal handler, which end with the signal frame
+        in_handler = unw_is_signal_frame(&cursor) <= 0;
+      } else if (!get_frame_info(&cursor, &addrs[ret])) {
+        break;
+      } else {
+        ret++;
+      }
+      if (unw_step(&cursor) <= 0) {
+        break;
+      }
+    }
+  }
+  return ret;
+}
+
 static int safe_backtrace_(unw_context_t *context, char *buf, int64_t len,
                    int64_t *pos)
 {
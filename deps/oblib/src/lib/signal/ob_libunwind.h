@@ -18,6 +18,9 @@
 
 EXTERN_C_BEGIN
 extern int safe_backtrace(char *buf, int64_t len, int64_t *pos);
+/* fill the addresses of the frames interrupted by the current signal,
+ * return the count of addresses or -1 on failure, async signal safe */
+extern int safe_sig_backtrace(uintptr_t *addrs, int64_t max_cnt);
 EXTERN_C_END
 
 #endif
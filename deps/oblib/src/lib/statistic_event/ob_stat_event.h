@@ -34,6 +34,10 @@ STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_COMPRESSED_PACKET_CNT, "rpc stream compre
 STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_ORIGINAL_SIZE, "rpc stream compress original size", ObStatClassIds::NETWORK, "rpc stream compress original size", 10018, true, true)
 STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_COMPRESSED_SIZE, "rpc stream compress compressed size", ObStatClassIds::NETWORK, "rpc stream compress compressed size", 10019, true, true)
 
+STAT_EVENT_ADD_DEF(MYSQL_COMPRESS_ORIGINAL_SIZE, "mysql compress original size", ObStatClassIds::NETWORK, "mysql compress original size", 10020, true, true)
+STAT_EVENT_ADD_DEF(MYSQL_COMPRESS_COMPRESSED_SIZE, "mysql compress compressed size", ObStatClassIds::NETWORK, "mysql compress compressed size", 10021, true, true)
+STAT_EVENT_ADD_DEF(MYSQL_COMPRESS_TIME, "mysql compress time", ObStatClassIds::NETWORK, "mysql compress time", 10022, true, true)
+
 // QUEUE
 // STAT_EVENT_ADD_DEF(REQUEST_QUEUED_COUNT, "REQUEST_QUEUED_COUNT", QUEUE, "REQUEST_QUEUED_COUNT")
 STAT_EVENT_ADD_DEF(REQUEST_ENQUEUE_COUNT, "request enqueue count", ObStatClassIds::QUEUE, "request enqueue count", 20000, true, true)
@@ -229,6 +233,10 @@ STAT_EVENT_ADD_DEF(TMP_BLOCK_CACHE_HIT, "tmp block cache hit", ObStatClassIds::C
 STAT_EVENT_ADD_DEF(TMP_BLOCK_CACHE_MISS, "tmp block cache miss", ObStatClassIds::CACHE, "tmp block cache miss", 50052, true, true)
 STAT_EVENT_ADD_DEF(SECONDARY_META_CACHE_HIT, "secondary meta cache hit", ObStatClassIds::CACHE, "secondary meta cache hit", 50053, true, true)
 STAT_EVENT_ADD_DEF(SECONDARY_META_CACHE_MISS, "secondary meta cache miss", ObStatClassIds::CACHE, "secondary meta cache miss", 50054, true, true)
+STAT_EVENT_ADD_DEF(RESULT_CACHE_HIT, "result cache hit", ObStatClassIds::CACHE, "result cache hit", 50055, true, true)
+STAT_EVENT_ADD_DEF(RESULT_CACHE_MISS, "result cache miss", ObStatClassIds::CACHE, "result cache miss", 50056, true, true)
+STAT_EVENT_ADD_DEF(RESULT_CACHE_INVALIDATE, "result cache invalidate", ObStatClassIds::CACHE, "result cache invalidate", 50057, true, true)
+STAT_EVENT_ADD_DEF(RESULT_CACHE_EVICT, "result cache evict", ObStatClassIds::CACHE, "result cache evict", 50058, true, true)
 
 
 // STORAGE
@@ -759,6 +767,7 @@ STAT_EVENT_SET_DEF(ASYNC_ACTIVE_LARGE_LOG_COUNT_FOR_ERR, "async active large log
 STAT_EVENT_SET_DEF(ASYNC_RELEASED_TINY_LOG_COUNT_FOR_ERR, "async released tiny log count for error log", ObStatClassIds::DEBUG, "async released tiny log count for error log", 160046, false, true)
 STAT_EVENT_SET_DEF(ASYNC_RELEASED_NORMAL_LOG_COUNT_FOR_ERR, "async released normal log count for error log", ObStatClassIds::DEBUG, "async released normal log count for error log", 160047, false, true)
 STAT_EVENT_SET_DEF(ASYNC_RELEASED_LARGE_LOG_COUNT_FOR_ERR, "async released large log count for error log", ObStatClassIds::DEBUG, "async released large log countfor error log", 160048, false, true)
+STAT_EVENT_SET_DEF(ASYNC_LOG_DELAYED_COUNT, "async log delayed count", ObStatClassIds::DEBUG, "async log delayed count", 160049, false, true)
 
 
 //OBSERVER
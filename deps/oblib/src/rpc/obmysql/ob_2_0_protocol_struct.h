@@ -31,6 +31,7 @@ union Ob20ProtocolFlags
   bool is_proxy_reroute() const { return 1 == st_flags_.OB_IS_PROXY_REROUTE; }
   bool is_new_extra_info() const { return 1 == st_flags_.OB_IS_NEW_EXTRA_INFO; }
   bool is_weak_read() const { return 1 == st_flags_.OB_IS_WEAK_READ; }
+  bool is_payload_compressed() const { return 1 == st_flags_.OB_IS_PAYLOAD_COMPRESSED; }
 
   uint32_t flags_;
   struct Protocol20Flags
@@ -40,7 +41,10 @@ union Ob20ProtocolFlags
     uint32_t OB_IS_PROXY_REROUTE:                       1;
     uint32_t OB_IS_NEW_EXTRA_INFO:                      1;
     uint32_t OB_IS_WEAK_READ:                           1;
-    uint32_t OB_FLAG_RESERVED_NOT_USE:                 27;
+    // payload is [4B uncompressed len][compressed data], compressor is negotiated
+    // by OB_CAP_OB20_LZ4_COMPRESS / OB_CAP_OB20_ZSTD_COMPRESS
+    uint32_t OB_IS_PAYLOAD_COMPRESSED:                  1;
+    uint32_t OB_FLAG_RESERVED_NOT_USE:                 26;
   } st_flags_;
 };
 
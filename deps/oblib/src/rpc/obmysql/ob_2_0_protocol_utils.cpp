@@ -16,6 +16,7 @@
 #include "lib/stat/ob_diagnose_info.h"
 #include "lib/checksum/ob_crc16.h"
 #include "lib/checksum/ob_crc64.h"
+#include "lib/compress/ob_compressor.h"
 #include "rpc/ob_request.h"
 #include "rpc/obmysql/ob_mysql_util.h"
 #include "rpc/obmysql/ob_mysql_request_utils.h"
@@ -503,6 +504,53 @@ inline int ObProto20Utils::fill_proto20_payload(ObProtoEncodeParam &param, bool
   return ret;
 }
 
+// compress the whole payload of current ob20 packet in place, the payload
+// becomes [4B uncompressed len][compressed data]. keep the raw payload if
+// compress fails or doesn't shrink it.
+int ObProto20Utils::compress_proto20_payload(ObProtoEncodeParam &param) {
+  INIT_SUCC(ret);
+  ObEasyBuffer easy_buffer(*param.ez_buf_);
+  ObProto20Context &proto20_context = *param.proto20_context_;
+  ObCompressor *compressor = proto20_context.compressor_;
+  char *start = easy_buffer.begin() + proto20_context.header_len_;
+  const int64_t len = easy_buffer.read_avail_size() - proto20_context.header_len_;
+  int64_t max_overflow_size = 0;
+  int64_t comp_buf_len = 0;
+  int64_t comp_size = 0;
+  char *comp_buf = NULL;
+  proto20_context.is_payload_compressed_ = false;
+  if (NULL == compressor || len < PROTO20_COMPRESS_MIN_LEN) {
+    // no need compress
+  } else if (OB_FAIL(compressor->get_max_overflow_size(len, max_overflow_size))) {
+    LOG_WARN("fail to get max overflow size", K(len), K(ret));
+  } else if (FALSE_IT(comp_buf_len = len + max_overflow_size)) {
+  } else if (OB_ISNULL(comp_buf = static_cast<char *>(ob_malloc(comp_buf_len, "Ob20Compress")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc compress buf", K(comp_buf_len), K(ret));
+  } else {
+    const int64_t begin_ts = ObTimeUtility::fast_current_time();
+    int64_t pos = 0;
+    if (OB_FAIL(compressor->compress(start, len, comp_buf, comp_buf_len, comp_size))) {
+      LOG_WARN("fail to compress ob20 payload", K(len), K(ret));
+    } else if (comp_size + static_cast<int64_t>(sizeof(uint32_t)) >= len) {
+      // not worth, send raw payload
+    } else if (OB_FAIL(ObMySQLUtil::store_int4(start, len, static_cast<uint32_t>(len), pos))) {
+      LOG_WARN("fail to store uncompressed len", K(len), K(ret));
+    } else {
+      MEMCPY(start + pos, comp_buf, comp_size);
+      easy_buffer.fall_back(len - pos - comp_size);
+      proto20_context.is_payload_compressed_ = true;
+      EVENT_ADD(MYSQL_COMPRESS_ORIGINAL_SIZE, len);
+      EVENT_ADD(MYSQL_COMPRESS_COMPRESSED_SIZE, pos + comp_size);
+    }
+    EVENT_ADD(MYSQL_COMPRESS_TIME, ObTimeUtility::fast_current_time() - begin_ts);
+    ob_free(comp_buf);
+  }
+  // compress is best effort
+  ret = OB_SUCCESS;
+  return ret;
+}
+
 inline int ObProto20Utils::fill_proto20_tailer(ObProtoEncodeParam &param) {
   INIT_SUCC(ret);
   ObEasyBuffer easy_buffer(*param.ez_buf_);
@@ -511,6 +559,8 @@ inline int ObProto20Utils::fill_proto20_tailer(ObProtoEncodeParam &param) {
   if (OB_UNLIKELY(easy_buffer.read_avail_size() <= 0)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_ERROR("invalid proto20 buffer", K(easy_buffer), K(ret));
+  } else if (OB_FAIL(compress_proto20_payload(param))) {
+    LOG_WARN("fail to compress payload", K(ret));
   } else if (OB_UNLIKELY(easy_buffer.write_avail_size() < proto20_context.tailer_len_)) {
     ret = OB_ERR_UNEXPECTED; // impossible
     LOG_ERROR("impossible", "write avail", easy_buffer.write_avail_size(),
@@ -555,6 +605,7 @@ inline int ObProto20Utils::fill_proto20_header(ObProtoEncodeParam &param) {
 
   flag.st_flags_.OB_IS_LAST_PACKET = (ObProto20Utils::is_the_last_packet(param) ? 1 : 0);
   flag.st_flags_.OB_IS_NEW_EXTRA_INFO = proto20_context.is_new_extra_info_;
+  flag.st_flags_.OB_IS_PAYLOAD_COMPRESSED = proto20_context.is_payload_compressed_;
   uint16_t reserved = 0;
   uint16_t header_checksum = 0;
   int64_t pos = 0;
@@ -600,6 +651,7 @@ inline int ObProto20Utils::fill_proto20_header(ObProtoEncodeParam &param) {
       LOG_ERROR("fail to store int2", K(ret));
     } else {
       proto20_context.next_step_ = FILL_DONE_STEP;
+      proto20_context.is_payload_compressed_ = false;
       LOG_DEBUG("fill proto20 header succ", K(compress_len), K(compress_seq), K(uncompress_len),
                 K(magic_num), K(version), K(connid), K(request_id), K(packet_seq), K(payload_len),
                 K(flag.flags_), K(reserved), K(header_checksum));
@@ -23,6 +23,10 @@
 
 namespace oceanbase
 {
+namespace common
+{
+class ObCompressor;
+}
 namespace obmysql
 {
 class ObMySQLPacket;
@@ -66,7 +70,8 @@ public:
       tailer_len_(0), next_step_(START_TO_FILL_STEP),
       is_proto20_used_(false), is_checksum_off_(false),
       has_extra_info_(false), is_new_extra_info_(false),
-      curr_proto20_packet_start_pos_(0) {}
+      curr_proto20_packet_start_pos_(0), compressor_(NULL),
+      is_payload_compressed_(false) {}
   ~ObProto20Context() {}
 
   inline void reset() { MEMSET(this, 0, sizeof(ObProto20Context)); }
@@ -81,7 +86,9 @@ public:
                 K_(is_checksum_off),
                 K_(has_extra_info),
                 K_(is_new_extra_info),
-                K_(curr_proto20_packet_start_pos));
+                K_(curr_proto20_packet_start_pos),
+                KP_(compressor),
+                K_(is_payload_compressed));
 
 public:
   uint8_t comp_seq_;
@@ -95,6 +102,9 @@ public:
   bool has_extra_info_;
   bool is_new_extra_info_;
   int64_t curr_proto20_packet_start_pos_;
+  // negotiated payload compressor, NULL means no compress
+  common::ObCompressor *compressor_;
+  bool is_payload_compressed_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObProto20Context);
@@ -207,12 +217,15 @@ private:
   inline static int encode_new_extra_info(char *buffer, int64_t length, int64_t &pos,
                                           ObIArray<Obp20Encoder*> *extra_info);
   inline static int fill_proto20_payload(ObProtoEncodeParam &param, bool &is_break);
+  static int compress_proto20_payload(ObProtoEncodeParam &param);
   inline static int fill_proto20_tailer(ObProtoEncodeParam &param);
   inline static int fill_proto20_header(ObProtoEncodeParam &param);
   inline static bool is_the_last_packet(const ObProtoEncodeParam &param);
   inline static bool has_extra_info(const ObProtoEncodeParam &param);
 
 private:
+  // small payload (ok/error packet, short result) is not worth compressing
+  static const int64_t PROTO20_COMPRESS_MIN_LEN = 1024;
   DISALLOW_COPY_AND_ASSIGN(ObProto20Utils);
 };
 
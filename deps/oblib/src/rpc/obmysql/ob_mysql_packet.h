@@ -139,6 +139,10 @@ union ObProxyCapabilityFlags
                                                         && is_ob_protocol_v2_support(); }
   bool is_new_extra_info_support() const { return 1 == cap_flags_.OB_CAP_PROXY_NEW_EXTRA_INFO
                                                         && is_ob_protocol_v2_support(); }
+  bool is_ob20_lz4_compress_support() const { return 1 == cap_flags_.OB_CAP_OB20_LZ4_COMPRESS
+                                                        && is_ob_protocol_v2_support(); }
+  bool is_ob20_zstd_compress_support() const { return 1 == cap_flags_.OB_CAP_OB20_ZSTD_COMPRESS
+                                                        && is_ob_protocol_v2_support(); }
 
   uint64_t capability_;
   struct CapabilityFlags
@@ -167,7 +171,10 @@ union ObProxyCapabilityFlags
     // for full trace_route
     uint64_t OB_CAP_PROXY_FULL_LINK_TRACING:           1;
     uint64_t OB_CAP_PROXY_NEW_EXTRA_INFO:              1;
-    uint64_t OB_CAP_RESERVED_NOT_USE:                 48;
+    // whether client can decompress ob20 payload compressed with lz4 / zstd
+    uint64_t OB_CAP_OB20_LZ4_COMPRESS:                 1;
+    uint64_t OB_CAP_OB20_ZSTD_COMPRESS:                1;
+    uint64_t OB_CAP_RESERVED_NOT_USE:                 46;
   } cap_flags_;
 };
 
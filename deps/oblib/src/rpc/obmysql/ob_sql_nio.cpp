@@ -284,9 +284,9 @@ public:
     buf_ = buf;
     sz_ = sz;
   }
-  int try_write(int fd, bool& become_clean) {
+  int try_write(int fd, bool& become_clean, int64_t& wbytes) {
     int ret = OB_SUCCESS;
-    int64_t wbytes = 0;
+    wbytes = 0;
     if (NULL == buf_) {
       // no pending task
     } else if (OB_FAIL(do_write(fd, buf_, sz_, wbytes))) {
@@ -304,12 +304,16 @@ private:
   int do_write(int fd, const char* buf, int64_t sz, int64_t& consume_bytes) {
     int ret = OB_SUCCESS;
     int64_t pos = 0;
-    while(pos < sz && OB_SUCCESS == ret) {
+    bool would_block = false;
+    while(pos < sz && OB_SUCCESS == ret && !would_block) {
       int64_t wbytes = 0;
       if ((wbytes = ob_write_regard_ssl(fd, buf + pos, sz - pos)) >= 0) {
         pos += wbytes;
       } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
-        LOG_INFO("write return EAGAIN");
+        // socket buffer is full, don't spin in nio thread which serves
+        // other socks too, the rest is written when EPOLLOUT triggered.
+        would_block = true;
+        LOG_DEBUG("write return EAGAIN", K(pos), K(sz));
       } else if (EINTR == errno) {
         // pass
       } else {
@@ -363,9 +367,9 @@ public:
   }
 
   bool is_need_epoll_trigger_write() const { return need_epoll_trigger_write_; }
-  int do_pending_write(bool& become_clean) {
+  int do_pending_write(bool& become_clean, int64_t& wbytes) {
     int ret = OB_SUCCESS;
-    if (OB_FAIL(pending_write_task_.try_write(fd_, become_clean))) {
+    if (OB_FAIL(pending_write_task_.try_write(fd_, become_clean, wbytes))) {
       need_epoll_trigger_write_ = false;
       LOG_WARN("pending write task write fail", K(ret));
     } else if (become_clean) {
@@ -373,11 +377,24 @@ public:
       need_epoll_trigger_write_ = false;
       LOG_DEBUG("pending write clean", K(this));
     } else {
-      LOG_INFO("need epoll trigger write", K(this));
+      LOG_DEBUG("need epoll trigger write", K(this));
       need_epoll_trigger_write_ = true;
     }
     return ret;
   }
+  // write pending task in worker thread without blocking, saves the round trip
+  // through nio thread for responses fit in socket buffer. what's left is
+  // written by nio thread.
+  bool try_write_directly() {
+    bool become_clean = false;
+    int64_t wbytes = 0;
+    if (OB_SUCCESS != pending_write_task_.try_write(fd_, become_clean, wbytes)) {
+      become_clean = false;
+    } else if (become_clean) {
+      last_write_time_ = ObTimeUtility::current_time();
+    }
+    return become_clean;
+  }
   int write_data(const char* buf, int64_t sz) {
     int ret = OB_SUCCESS;
     int64_t pos = 0;
@@ -570,6 +587,24 @@ private:
   int evfd_;
   int in_epoll_ CACHE_ALIGNED;
 };
+
+// per nio thread statistics, printed periodically
+struct ObSqlNioStat
+{
+  ObSqlNioStat() { reset(); }
+  void reset() { memset(this, 0, sizeof(*this)); }
+  TO_STRING_KV(K_(epoll_wait_cnt), K_(event_cnt), K_(accept_cnt), K_(write_cnt),
+               K_(write_bytes), K_(partial_write_cnt), K_(busy_us));
+  int64_t epoll_wait_cnt_;
+  int64_t event_cnt_;
+  int64_t accept_cnt_;
+  int64_t write_cnt_;
+  int64_t write_bytes_;
+  int64_t partial_write_cnt_;
+  // time spent out of epoll_wait
+  int64_t busy_us_;
+};
+
 /*
   how a socket destroy:
   set_error() -> prepare_destroy() -> wait_handing() -> handler.on_close()
@@ -583,7 +618,8 @@ class ObSqlNioImpl
 public:
   ObSqlNioImpl(ObISqlSockHandler& handler):
     handler_(handler), epfd_(-1), lfd_(-1), tcp_keepalive_enabled_(0),
-    tcp_keepidle_(0), tcp_keepintvl_(0), tcp_keepcnt_(0) {}
+    tcp_keepidle_(0), tcp_keepintvl_(0), tcp_keepcnt_(0), stat_(),
+    last_stat_ts_(ObTimeUtility::current_time()), last_busy_begin_ts_(0) {}
   ~ObSqlNioImpl() {}
   int init(int port) {
     int ret = OB_SUCCESS;
@@ -617,6 +653,7 @@ public:
     handle_pending_destroy_list();
     update_tcp_keepalive_parameters();
     print_session_info();
+    print_nio_stat();
   }
   void push_close_req(ObSqlSock* s) {
     if (s->set_error(EIO)) {
@@ -630,6 +667,14 @@ public:
     write_req_queue_.push(&s->write_task_link_);
     evfd_.signal();
   }
+  void async_write(ObSqlSock* s) {
+    if (!s->has_error() && s->try_write_directly()) {
+      // pipelined request already buffered is decoded in revert_sock()
+      handler_.on_flushed(s->sess_);
+    } else {
+      push_write_req(s);
+    }
+  }
   void revert_sock(ObSqlSock* s) {
     if (OB_UNLIKELY(s->has_error())) {
       LOG_TRACE("revert_sock: sock has error", K(*s));
@@ -658,7 +703,14 @@ private:
   void handle_epoll_event() {
     const int maxevents = 512;
     struct epoll_event events[maxevents];
+    const int64_t wait_begin_ts = ObTimeUtility::fast_current_time();
+    if (last_busy_begin_ts_ > 0) {
+      stat_.busy_us_ += wait_begin_ts - last_busy_begin_ts_;
+    }
     int cnt = epoll_wait(epfd_, events, maxevents, 1000);
+    last_busy_begin_ts_ = ObTimeUtility::fast_current_time();
+    stat_.epoll_wait_cnt_++;
+    stat_.event_cnt_ += cnt > 0 ? cnt : 0;
     for(int i = 0; i < cnt; i++) {
       ObSqlSock* s = (ObSqlSock*)events[i].data.ptr;
       if (OB_UNLIKELY(NULL == s)) {
@@ -750,10 +802,15 @@ private:
   int do_pending_write(ObSqlSock* s) {
     int ret = OB_SUCCESS;
     bool become_clean = false;
-    if (OB_FAIL(s->do_pending_write(become_clean))) {
+    int64_t wbytes = 0;
+    if (OB_FAIL(s->do_pending_write(become_clean, wbytes))) {
     } else if (become_clean) {
       handler_.on_flushed(s->sess_);
+    } else {
+      stat_.partial_write_cnt_++;
     }
+    stat_.write_cnt_++;
+    stat_.write_bytes_ += wbytes;
     return ret;
   }
   void handle_write_req_queue() {
@@ -783,6 +840,7 @@ private:
         }
       } else {
         int err = 0;
+        stat_.accept_cnt_++;
         if (0 != (err = do_accept_one(fd))) {
           LOG_ERROR("do_accept_one fail", K(fd), K(err));
           close(fd);
@@ -876,6 +934,18 @@ private:
       }
     }
   }
+  void print_nio_stat() {
+    if (TC_REACH_TIME_INTERVAL(10*1000*1000L)) {
+      const int64_t now = ObTimeUtility::current_time();
+      const int64_t interval_us = std::max(now - last_stat_ts_, 1L);
+      const int64_t busy_pct = stat_.busy_us_ * 100 / interval_us;
+      const int64_t syscall_per_sec = (stat_.epoll_wait_cnt_ + stat_.accept_cnt_ + stat_.write_cnt_)
+                                      * 1000000 / interval_us;
+      LOG_INFO("[sql nio stat]", K_(stat), K(interval_us), K(busy_pct), K(syscall_per_sec));
+      stat_.reset();
+      last_stat_ts_ = now;
+    }
+  }
   static void* direct_alloc(int64_t sz) { return common::ob_malloc(sz, common::ObModIds::OB_COMMON_NETWORK); }
   static void direct_free(void* p) { common::ob_free(p); }
 
@@ -892,6 +962,9 @@ private:
   uint32_t tcp_keepidle_;
   uint32_t tcp_keepintvl_;
   uint32_t tcp_keepcnt_;
+  ObSqlNioStat stat_;
+  int64_t last_stat_ts_;
+  int64_t last_busy_begin_ts_;
 };
 
 int ObSqlNio::start(int port, ObISqlSockHandler* handler, int n_thread)
@@ -1010,7 +1083,7 @@ void ObSqlNio::async_write_data(void* sess, const char* buf, int64_t sz)
 {
   ObSqlSock* sock = sess2sock(sess);
   sock->init_write_task(buf, sz);
-  sock->get_nio_impl().push_write_req(sock);
+  sock->get_nio_impl().async_write(sock);
 }
 
 int ObSqlNio::set_ssl_enabled(void* sess)
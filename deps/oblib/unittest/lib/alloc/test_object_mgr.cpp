@@ -19,6 +19,8 @@
 #include "lib/utility/ob_test_util.h"
 #include "lib/coro/testing.h"
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -280,3 +282,160 @@ TEST_F(TestObjectMgr, TestSubObjectMgr)
     rec++;
   }
 }
+
+TEST_F(TestObjectMgr, TestObjectCache)
+{
+  ASSERT_TRUE(ObjectCache::is_enabled());
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  auto &om = static_cast<ObjectMgr&>(ta->get_block_mgr());
+  ObMemAttr attr(OB_SERVER_TENANT_ID, "CacheTest");
+  void *ptr = ob_malloc(100, attr);
+  ASSERT_NE(nullptr, ptr);
+  auto *obj = (AObject*)((char*)ptr - AOBJECT_HEADER_SIZE);
+  int64_t used = om.get_stat().used_;
+
+  // freed object stays in use for the object set, but is marked as cached and relabeled
+  ASSERT_FALSE(obj->in_obj_cache_);
+  ob_free(ptr);
+  ASSERT_TRUE(obj->in_use_);
+  ASSERT_TRUE(obj->in_obj_cache_);
+  ASSERT_STREQ(ObjectCache::CACHED_LABEL, obj->label_);
+  ASSERT_EQ(used, om.get_stat().used_);
+
+  // same size hits the cache and takes the new label
+  void *ptr2 = ob_malloc(100, ObMemAttr(OB_SERVER_TENANT_ID, "CacheTest2"));
+  ASSERT_EQ(ptr, ptr2);
+  ASSERT_FALSE(obj->in_obj_cache_);
+  ASSERT_STREQ("CacheTest2", obj->label_);
+  ASSERT_EQ(AOBJECT_TAIL_MAGIC_CODE, reinterpret_cast<uint64_t&>(obj->data_[100]));
+
+  // different size misses
+  ob_free(ptr2);
+  void *ptr3 = ob_malloc(101, attr);
+  ASSERT_NE(ptr, ptr3);
+  ob_free(ptr3);
+
+  // flushed objects go back to the object set
+  ObjectCache::get_instance()->flush(om);
+  ASSERT_GT(used, om.get_stat().used_);
+
+  // a bin never caches more than MAX_BIN_OBJ_CNT objects
+  void *ptrs[ObjectCache::MAX_BIN_OBJ_CNT + 1];
+  for (int i = 0; i < ObjectCache::MAX_BIN_OBJ_CNT + 1; i++) {
+    ptrs[i] = ob_malloc(64, attr);
+  }
+  used = om.get_stat().used_;
+  for (int i = 0; i < ObjectCache::MAX_BIN_OBJ_CNT + 1; i++) {
+    ob_free(ptrs[i]);
+  }
+  ASSERT_GT(used, om.get_stat().used_);
+  used = om.get_stat().used_;
+  ObjectCache::get_instance()->flush(om);
+  ASSERT_GT(used, om.get_stat().used_);
+}
+
+TEST_F(TestObjectMgr, TestObjectCacheOfOtherThread)
+{
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  auto &om = static_cast<ObjectMgr&>(ta->get_block_mgr());
+  ObMemAttr attr(OB_SERVER_TENANT_ID, "CacheTest");
+  AObject *obj = nullptr;
+  int64_t used = 0;
+  bool cached = false;
+  bool flushed = false;
+  std::thread th([&]() {
+    void *ptr = ob_malloc(200, attr);
+    obj = (AObject*)((char*)ptr - AOBJECT_HEADER_SIZE);
+    used = om.get_stat().used_;
+    ob_free(ptr);
+    ATOMIC_STORE(&cached, true);
+    // keep the thread and its cache alive until the main thread takes the object back
+    while (!ATOMIC_LOAD(&flushed)) {
+      usleep(1000);
+    }
+  });
+  while (!ATOMIC_LOAD(&cached)) {
+    usleep(1000);
+  }
+  ASSERT_TRUE(obj->in_obj_cache_);
+  ASSERT_EQ(used, om.get_stat().used_);
+  // flush of the calling thread doesn't touch the cache of other threads
+  ObjectCache::get_instance()->flush(om);
+  ASSERT_EQ(used, om.get_stat().used_);
+  ObjectCache::flush_all_threads(om);
+  ASSERT_GT(used, om.get_stat().used_);
+  ATOMIC_STORE(&flushed, true);
+  th.join();
+}
+
+TEST_F(TestObjectMgr, TestObjectCacheHold)
+{
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  auto &om = static_cast<ObjectMgr&>(ta->get_block_mgr());
+  ObMemAttr attr(OB_SERVER_TENANT_ID, "CacheTest");
+  ObjectCache::get_instance()->flush_all();
+  // a slot never holds more than MAX_SLOT_HOLD, objects over it go back to the object set
+  const int64_t cnt = ObjectCache::BIN_CNT * ObjectCache::MAX_BIN_OBJ_CNT;
+  void *ptrs[cnt];
+  int64_t idx = 0;
+  const int64_t used = om.get_stat().used_;
+  for (int64_t size = ObjectCache::BIN_SIZE; size <= ObjectCache::MAX_CACHE_OBJ_SIZE;
+       size += ObjectCache::BIN_SIZE) {
+    for (int64_t i = 0; i < ObjectCache::MAX_BIN_OBJ_CNT; i++) {
+      ptrs[idx++] = ob_malloc(size, attr);
+    }
+  }
+  for (int64_t i = 0; i < cnt; i++) {
+    ob_free(ptrs[i]);
+  }
+  const int64_t cached = om.get_stat().used_ - used;
+  ASSERT_GT(cached, 0);
+  ASSERT_LE(cached, ObjectCache::MAX_SLOT_HOLD);
+  ObjectCache::get_instance()->flush(om);
+  ASSERT_GT(used + cached, om.get_stat().used_);
+}
+
+TEST_F(TestObjectMgr, TestObjectCacheConcurrentDisable)
+{
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  ObMemAttr attr(OB_SERVER_TENANT_ID, "CacheTest");
+  const int64_t th_cnt = 4;
+  for (int64_t round = 0; round < 100; round++) {
+    ObjectMgr om(*ta, OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+    bool stop = false;
+    bool checked = false;
+    int64_t done_cnt = 0;
+    std::vector<std::thread> ths;
+    for (int64_t i = 0; i < th_cnt; i++) {
+      ths.push_back(std::thread([&]() {
+        while (!ATOMIC_LOAD(&stop)) {
+          AObject *obj = om.alloc_object(100, attr);
+          abort_unless(nullptr != obj);
+          om.free_object(obj);
+        }
+        ATOMIC_INC(&done_cnt);
+        // keep the cache of the thread alive until the main thread has checked it
+        while (!ATOMIC_LOAD(&checked)) {
+          usleep(1000);
+        }
+      }));
+    }
+    usleep(1000);
+    // the objects pushed by the other threads while disabling are either taken
+    // back by the flush or not cached at all
+    om.disable_obj_cache();
+    ATOMIC_STORE(&stop, true);
+    while (ATOMIC_LOAD(&done_cnt) < th_cnt) {
+      usleep(1000);
+    }
+    ASSERT_EQ(0, om.get_stat().used_);
+    ATOMIC_STORE(&checked, true);
+    for (auto &th : ths) {
+      th.join();
+    }
+  }
+}
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "lib/profile/ob_cpu_profiler.h"
+#include <gtest/gtest.h>
+#include "lib/time/ob_time_utility.h"
+#include "lib/utility/ob_test_util.h"
+
+using namespace oceanbase::common;
+
+static int64_t burn_cpu(const int64_t us)
+{
+  int64_t sum = 0;
+  const int64_t end = ObTimeUtility::current_time() + us;
+  while (ObTimeUtility::current_time() < end) {
+    for (int64_t i = 0; i < 1000; i++) {
+      sum += i * i;
+    }
+  }
+  return sum;
+}
+
+TEST(TestCpuProfiler, invalid_frequency)
+{
+  ObCpuProfiler &profiler = ObCpuProfiler::get_instance();
+  ASSERT_EQ(OB_INVALID_ARGUMENT, profiler.set_frequency(-1));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, profiler.set_frequency(ObCpuProfiler::MAX_FREQUENCY + 1));
+  ASSERT_EQ(0, profiler.get_frequency());
+}
+
+TEST(TestCpuProfiler, sample)
+{
+  ObCpuProfiler &profiler = ObCpuProfiler::get_instance();
+  snprintf(ob_get_tname(), OB_THREAD_NAME_BUF_LEN, "%s", "TestProf");
+  ASSERT_EQ(OB_SUCCESS, profiler.set_frequency(1000));
+  ASSERT_LT(0, burn_cpu(500 * 1000));
+  ASSERT_EQ(OB_SUCCESS, profiler.set_frequency(0));
+  ASSERT_LT(0, profiler.get_sample_cnt());
+
+  // samples are kept after stopped
+  int64_t total = 0;
+  bool found_thread = false;
+  char buf[1024];
+  for (int64_t i = 0; i < ObCpuProfiler::ENTRY_CNT; i++) {
+    const ObCpuProfileEntry *entry = profiler.get_entry(i);
+    if (NULL != entry) {
+      total += entry->count_;
+      ASSERT_LT(0, entry->depth_);
+      ASSERT_LT(0, entry->print_folded_stack(buf, sizeof(buf)));
+      found_thread |= (0 == STRCMP(entry->tname_, "TestProf"));
+    }
+  }
+  ASSERT_TRUE(found_thread);
+  ASSERT_EQ(profiler.get_sample_cnt(), total + profiler.get_dropped_cnt());
+
+  // restart with empty samples
+  ASSERT_EQ(OB_SUCCESS, profiler.set_frequency(100));
+  ASSERT_EQ(OB_SUCCESS, profiler.set_frequency(0));
+  ASSERT_GT(total, profiler.get_sample_cnt());
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "lib/profile/ob_hw_perf_counter.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace oceanbase::common;
+
+TEST(TestHwPerfCounters, thread_counters)
+{
+  ObHwPerfCounters *counters = ObHwPerfCounters::get_thread_counters();
+  // same instance for the same thread
+  ASSERT_EQ(counters, ObHwPerfCounters::get_thread_counters());
+  ObHwPerfCounters *other = NULL;
+  std::thread th([&other]() { other = ObHwPerfCounters::get_thread_counters(); });
+  th.join();
+  if (NULL != counters) {
+    ASSERT_NE(counters, other);
+  }
+}
+
+TEST(TestHwPerfCounters, monotonic)
+{
+  ObHwPerfCounters *counters = ObHwPerfCounters::get_thread_counters();
+  if (NULL == counters) {
+    // hardware counters are not available in virtualized or restricted environments
+    return;
+  }
+  uint64_t begin[ObHwPerfCounters::MAX_COUNTER];
+  uint64_t end[ObHwPerfCounters::MAX_COUNTER];
+  counters->read(begin);
+  volatile int64_t sum = 0;
+  for (int64_t i = 0; i < 1000000; i++) {
+    sum += i;
+  }
+  counters->read(end);
+  for (int64_t i = 0; i < ObHwPerfCounters::MAX_COUNTER; i++) {
+    ASSERT_GE(end[i], begin[i]);
+  }
+  ASSERT_GT(end[ObHwPerfCounters::INSTRUCTIONS], begin[ObHwPerfCounters::INSTRUCTIONS]);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "rpc/obmysql/ob_2_0_protocol_utils.h"
+#undef private
+#include "rpc/obmysql/ob_mysql_util.h"
+#include "rpc/obmysql/ob_mysql_request_utils.h"
+#include "lib/compress/ob_compressor_pool.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+
+class TestOb20Compress : public ::testing::Test
+{
+public:
+  static const int64_t HEADER_LEN = OB20_PROTOCOL_HEADER_LENGTH + OB_MYSQL_COMPRESSED_HEADER_SIZE;
+  static const int64_t BUF_LEN = 128 * 1024;
+
+  TestOb20Compress() : compressor_(NULL) {}
+
+  virtual void SetUp()
+  {
+    MEMSET(&ez_buf_, 0, sizeof(ez_buf_));
+    ez_buf_.pos = buf_;
+    ez_buf_.last = buf_ + HEADER_LEN;
+    ez_buf_.end = buf_ + BUF_LEN;
+    context_.header_len_ = HEADER_LEN;
+    param_.proto20_context_ = &context_;
+    param_.ez_buf_ = &ez_buf_;
+  }
+
+  void fill_payload(const char *payload, const int64_t len)
+  {
+    MEMCPY(ez_buf_.last, payload, len);
+    ez_buf_.last += len;
+  }
+
+  // compress the payload as the encoder does before filling the tailer
+  void compress(const ObCompressorType type)
+  {
+    ASSERT_EQ(OB_SUCCESS, ObCompressorPool::get_instance().get_compressor(type, compressor_));
+    context_.compressor_ = compressor_;
+    ASSERT_EQ(OB_SUCCESS, ObProto20Utils::compress_proto20_payload(param_));
+  }
+
+  int64_t payload_len() const { return ez_buf_.last - ez_buf_.pos - HEADER_LEN; }
+
+  // decompress the payload as the client does, [4B uncompressed len][compressed data]
+  void check_round_trip(const char *expect, const int64_t expect_len)
+  {
+    const char *pos = buf_ + HEADER_LEN;
+    uint32_t uncompressed_len = 0;
+    int64_t data_size = 0;
+    ObMySQLUtil::get_uint4(pos, uncompressed_len);
+    ASSERT_EQ(expect_len, static_cast<int64_t>(uncompressed_len));
+    ASSERT_EQ(OB_SUCCESS, compressor_->decompress(pos, payload_len() - sizeof(uint32_t),
+                                                  out_, sizeof(out_), data_size));
+    ASSERT_EQ(expect_len, data_size);
+    ASSERT_EQ(0, MEMCMP(expect, out_, expect_len));
+  }
+
+protected:
+  char buf_[BUF_LEN];
+  char out_[BUF_LEN];
+  easy_buf_t ez_buf_;
+  ObProto20Context context_;
+  ObProtoEncodeParam param_;
+  ObCompressor *compressor_;
+};
+
+// repeated rows of a result set
+static void gen_compressible(char *buf, const int64_t len)
+{
+  const char *row = "1,hello world,2023-01-01 00:00:00,3.1415926\n";
+  const int64_t row_len = STRLEN(row);
+  for (int64_t i = 0; i < len; ++i) {
+    buf[i] = row[i % row_len];
+  }
+}
+
+static void gen_incompressible(char *buf, const int64_t len)
+{
+  uint64_t x = 88172645463325252UL;
+  for (int64_t i = 0; i < len; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    buf[i] = static_cast<char>(x >> 56);
+  }
+}
+
+TEST_F(TestOb20Compress, round_trip)
+{
+  ObCompressorType types[] = {LZ4_COMPRESSOR, ZSTD_1_3_8_COMPRESSOR};
+  const int64_t lens[] = {ObProto20Utils::PROTO20_COMPRESS_MIN_LEN, 16 * 1024, 100 * 1024};
+  char *payload = new char[BUF_LEN];
+  for (int64_t i = 0; i < ARRAYSIZEOF(types); ++i) {
+    for (int64_t j = 0; j < ARRAYSIZEOF(lens); ++j) {
+      SetUp();
+      gen_compressible(payload, lens[j]);
+      fill_payload(payload, lens[j]);
+      compress(types[i]);
+      ASSERT_TRUE(context_.is_payload_compressed_);
+      ASSERT_LT(payload_len(), lens[j]);
+      check_round_trip(payload, lens[j]);
+    }
+  }
+  delete []payload;
+}
+
+TEST_F(TestOb20Compress, incompressible_payload_sent_raw)
+{
+  ObCompressorType types[] = {LZ4_COMPRESSOR, ZSTD_1_3_8_COMPRESSOR};
+  const int64_t len = 64 * 1024;
+  char *payload = new char[BUF_LEN];
+  gen_incompressible(payload, len);
+  for (int64_t i = 0; i < ARRAYSIZEOF(types); ++i) {
+    SetUp();
+    fill_payload(payload, len);
+    compress(types[i]);
+    ASSERT_FALSE(context_.is_payload_compressed_);
+    ASSERT_EQ(len, payload_len());
+    ASSERT_EQ(0, MEMCMP(payload, buf_ + HEADER_LEN, len));
+  }
+  delete []payload;
+}
+
+TEST_F(TestOb20Compress, small_payload_sent_raw)
+{
+  const int64_t len = ObProto20Utils::PROTO20_COMPRESS_MIN_LEN - 1;
+  char payload[ObProto20Utils::PROTO20_COMPRESS_MIN_LEN];
+  gen_compressible(payload, len);
+  fill_payload(payload, len);
+  compress(LZ4_COMPRESSOR);
+  ASSERT_FALSE(context_.is_payload_compressed_);
+  ASSERT_EQ(len, payload_len());
+  ASSERT_EQ(0, MEMCMP(payload, buf_ + HEADER_LEN, len));
+}
+
+TEST_F(TestOb20Compress, no_compressor)
+{
+  const int64_t len = 16 * 1024;
+  char *payload = new char[len];
+  gen_compressible(payload, len);
+  fill_payload(payload, len);
+  ASSERT_EQ(OB_SUCCESS, ObProto20Utils::compress_proto20_payload(param_));
+  ASSERT_FALSE(context_.is_payload_compressed_);
+  ASSERT_EQ(len, payload_len());
+  delete []payload;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
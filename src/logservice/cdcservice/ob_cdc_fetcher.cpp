@@ -115,6 +115,15 @@ int ObCdcFetcher::fetch_log(const ObCdcLSFetchLogReq &req,
     EVENT_ADD(CLOG_EXTLOG_FETCH_LOG_SIZE, fetch_log_size);
     ObCdcServiceMonitor::fetch_log_count(fetch_log_count);
     EVENT_ADD(CLOG_EXTLOG_FETCH_LOG_COUNT, fetch_log_count);
+
+    // Compress log payload as negotiated by CDC Connector, failure of compression
+    // is not fatal since raw log is still in resp.
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = resp.compress_payload(req.get_compressor_type()))) {
+      LOG_WARN("compress fetch log resp fail, send raw log", K(tmp_ret), K(req));
+    } else if (resp.is_compressed()) {
+      ObCdcServiceMonitor::compressed_size(resp.get_pos());
+    }
   }
 
   resp.set_err(ret);
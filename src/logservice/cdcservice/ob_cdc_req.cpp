@@ -12,6 +12,7 @@
 
 #include "ob_cdc_req.h"
 #include "lib/utility/ob_unify_serialize.h"
+#include "lib/compress/ob_compressor_pool.h"    // ObCompressorPool
 
 namespace oceanbase
 {
@@ -246,7 +247,7 @@ OB_DEF_DESERIALIZE(ObCdcReqStartLSNByTsResp)
  *
  */
 OB_SERIALIZE_MEMBER(ObCdcLSFetchLogReq, rpc_ver_, ls_id_, start_lsn_,
-                    upper_limit_ts_, client_pid_);
+                    upper_limit_ts_, client_pid_, compressor_type_);
 OB_SERIALIZE_MEMBER(ObCdcFetchStatus,
                     is_reach_max_lsn_,
                     is_reach_upper_limit_ts_,
@@ -262,6 +263,9 @@ OB_DEF_SERIALIZE(ObCdcLSFetchLogResp)
 
   LST_DO_CODE(OB_UNIS_ENCODE, rpc_ver_, err_, debug_err_,
               ls_id_, feedback_type_, fetch_status_, next_req_lsn_, log_num_, pos_);
+  if (OB_SUCC(ret) && is_compressed()) {
+    LST_DO_CODE(OB_UNIS_ENCODE, compressor_type_, raw_data_len_);
+  }
 
   if (OB_SUCCESS == ret && pos_ > 0) {
     if (buf_len - pos < pos_) {
@@ -280,9 +284,12 @@ OB_DEF_SERIALIZE_SIZE(ObCdcLSFetchLogResp)
   int64_t len = 0;
   int tmp_ret = OB_SUCCESS;
 
-  if (CUR_RPC_VER == rpc_ver_) {
+  if (CUR_RPC_VER == rpc_ver_ || COMPRESSED_RPC_VER == rpc_ver_) {
     LST_DO_CODE(OB_UNIS_ADD_LEN, rpc_ver_, err_, debug_err_,
                 ls_id_, feedback_type_, fetch_status_, next_req_lsn_, log_num_, pos_);
+    if (is_compressed()) {
+      LST_DO_CODE(OB_UNIS_ADD_LEN, compressor_type_, raw_data_len_);
+    }
     len += pos_;
   } else {
     tmp_ret = OB_NOT_SUPPORTED;
@@ -298,11 +305,16 @@ OB_DEF_DESERIALIZE(ObCdcLSFetchLogResp)
   int ret = OB_SUCCESS;
 
   LST_DO_CODE(OB_UNIS_DECODE, rpc_ver_);
-  if (CUR_RPC_VER == rpc_ver_) {
+  if (CUR_RPC_VER == rpc_ver_ || COMPRESSED_RPC_VER == rpc_ver_) {
     LST_DO_CODE(OB_UNIS_DECODE, err_, debug_err_,
                 ls_id_, feedback_type_, fetch_status_, next_req_lsn_, log_num_, pos_);
+    if (OB_SUCC(ret) && is_compressed()) {
+      LST_DO_CODE(OB_UNIS_DECODE, compressor_type_, raw_data_len_);
+    }
 
-    if (OB_UNLIKELY(! is_valid())) {
+    if (OB_FAIL(ret)) {
+      EXTLOG_LOG(WARN, "deserialize header fail", K(ret), K(rpc_ver_));
+    } else if (OB_UNLIKELY(! is_valid())) {
       ret = OB_ERR_UNEXPECTED;
       EXTLOG_LOG(ERROR, "pos_ is not valid", K(ret), K(pos_));
     } else if (pos_ > 0) {
@@ -325,6 +337,7 @@ void ObCdcLSFetchLogReq::reset()
   start_lsn_.reset();
   upper_limit_ts_ = 0;
   client_pid_ = 0;
+  compressor_type_ = common::INVALID_COMPRESSOR;
 }
 
 ObCdcLSFetchLogReq& ObCdcLSFetchLogReq::operator=(const ObCdcLSFetchLogReq &other)
@@ -333,6 +346,7 @@ ObCdcLSFetchLogReq& ObCdcLSFetchLogReq::operator=(const ObCdcLSFetchLogReq &othe
   ls_id_ = other.ls_id_;
   start_lsn_ = other.start_lsn_;
   upper_limit_ts_ = other.upper_limit_ts_;
+  compressor_type_ = other.compressor_type_;
 
   return *this;
 }
@@ -428,9 +442,18 @@ int ObCdcLSFetchLogResp::assign(const ObCdcLSFetchLogResp &other)
     next_req_lsn_ = other.next_req_lsn_;
     log_num_ = other.log_num_;
     pos_ = other.pos_;
+    compressor_type_ = other.compressor_type_;
+    raw_data_len_ = other.raw_data_len_;
     log_entry_buf_[0] = '\0';
 
-    if (log_num_ > 0 && pos_ > 0) {
+    if (log_num_ <= 0 || pos_ <= 0) {
+      // no log payload
+    } else if (other.is_compressed()) {
+      // decompress directly into our buffer to avoid one extra copy
+      if (OB_FAIL(decompress_payload_(other))) {
+        EXTLOG_LOG(WARN, "decompress log payload fail", K(ret), K(other));
+      }
+    } else {
       (void)MEMCPY(log_entry_buf_, other.log_entry_buf_, pos_);
     }
   }
@@ -438,6 +461,87 @@ int ObCdcLSFetchLogResp::assign(const ObCdcLSFetchLogResp &other)
   return ret;
 }
 
+int ObCdcLSFetchLogResp::compress_payload(const common::ObCompressorType compressor_type)
+{
+  int ret = OB_SUCCESS;
+  common::ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  char *comp_buf = NULL;
+  int64_t comp_buf_len = 0;
+  int64_t comp_size = 0;
+
+  if (OB_UNLIKELY(is_compressed())) {
+    ret = OB_STATE_NOT_MATCH;
+    EXTLOG_LOG(WARN, "log payload is already compressed", K(ret), KPC(this));
+  } else if (common::INVALID_COMPRESSOR == compressor_type
+      || common::NONE_COMPRESSOR == compressor_type
+      || pos_ <= 0) {
+    // no need compress
+  } else if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    EXTLOG_LOG(WARN, "get compressor fail", K(ret), K(compressor_type));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    EXTLOG_LOG(WARN, "compressor is NULL", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(pos_, max_overflow_size))) {
+    EXTLOG_LOG(WARN, "get max overflow size fail", K(ret), K(pos_));
+  } else {
+    comp_buf_len = pos_ + max_overflow_size;
+    if (OB_ISNULL(comp_buf = static_cast<char *>(common::ob_malloc(comp_buf_len, "CdcCompBuf")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      EXTLOG_LOG(WARN, "alloc compress buffer fail", K(ret), K(comp_buf_len));
+    } else if (OB_FAIL(compressor->compress(log_entry_buf_, pos_, comp_buf, comp_buf_len, comp_size))) {
+      EXTLOG_LOG(WARN, "compress log payload fail", K(ret), K(compressor_type), K(pos_));
+    } else if (comp_size >= pos_) {
+      // compress is not work, just use original data.
+    } else {
+      MEMCPY(log_entry_buf_, comp_buf, comp_size);
+      rpc_ver_ = COMPRESSED_RPC_VER;
+      compressor_type_ = compressor_type;
+      raw_data_len_ = pos_;
+      pos_ = comp_size;
+    }
+    compressor->reset_mem();
+  }
+
+  if (NULL != comp_buf) {
+    common::ob_free(comp_buf);
+    comp_buf = NULL;
+  }
+
+  return ret;
+}
+
+int ObCdcLSFetchLogResp::decompress_payload_(const ObCdcLSFetchLogResp &other)
+{
+  int ret = OB_SUCCESS;
+  common::ObCompressor *compressor = NULL;
+  int64_t decomp_size = 0;
+
+  if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor(other.compressor_type_, compressor))) {
+    EXTLOG_LOG(WARN, "get compressor fail", K(ret), K(other.compressor_type_));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    EXTLOG_LOG(WARN, "compressor is NULL", K(ret), K(other.compressor_type_));
+  } else if (OB_FAIL(compressor->decompress(other.log_entry_buf_, other.pos_,
+      log_entry_buf_, FETCH_BUF_LEN, decomp_size))) {
+    EXTLOG_LOG(WARN, "decompress log payload fail", K(ret), K(other.pos_), K(other.raw_data_len_));
+  } else if (OB_UNLIKELY(decomp_size != other.raw_data_len_)) {
+    ret = OB_CHECKSUM_ERROR;
+    EXTLOG_LOG(ERROR, "decompressed size not match", K(ret), K(decomp_size), K(other.raw_data_len_));
+  } else {
+    rpc_ver_ = CUR_RPC_VER;
+    compressor_type_ = common::INVALID_COMPRESSOR;
+    raw_data_len_ = 0;
+    pos_ = decomp_size;
+  }
+
+  if (NULL != compressor) {
+    compressor->reset_mem();
+  }
+
+  return ret;
+}
+
 void ObCdcLSFetchLogResp::reset()
 {
   rpc_ver_ = CUR_RPC_VER;
@@ -449,6 +553,8 @@ void ObCdcLSFetchLogResp::reset()
   next_req_lsn_.reset();
   log_num_ = 0;
   pos_ = 0;
+  compressor_type_ = common::INVALID_COMPRESSOR;
+  raw_data_len_ = 0;
   log_entry_buf_[0] = '\0';
 }
 
@@ -18,6 +18,7 @@
 #include "logservice/palf/lsn.h"                // LSN
 #include "logservice/palf/log_group_entry.h"    // LogGroupEntry
 #include "logservice/palf/log_entry.h"          // LogEntry
+#include "lib/compress/ob_compress_util.h"      // ObCompressorType
 
 namespace oceanbase
 {
@@ -167,11 +168,18 @@ public:
   void set_client_pid(const uint64_t id) { client_pid_ = id; }
   uint64_t get_client_pid() const { return client_pid_; }
 
+  // Compressor which CDC Connector accepts for the log payload of response.
+  // Server which does not recognize this field ignores it and returns raw log,
+  // so it is safe to set it against servers of older version.
+  void set_compressor_type(const common::ObCompressorType type) { compressor_type_ = type; }
+  common::ObCompressorType get_compressor_type() const { return compressor_type_; }
+
   TO_STRING_KV(K_(rpc_ver),
       K_(ls_id),
       K_(start_lsn),
       K_(upper_limit_ts),
-      K_(client_pid));
+      K_(client_pid),
+      K_(compressor_type));
 
   OB_UNIS_VERSION(1);
 
@@ -181,6 +189,7 @@ private:
   LSN start_lsn_;
   int64_t upper_limit_ts_;
   uint64_t client_pid_;  // Process ID.
+  common::ObCompressorType compressor_type_;
 };
 
 // Statistics for LS
@@ -238,6 +247,9 @@ struct ObCdcFetchStatus
 class ObCdcLSFetchLogResp
 {
   static const int64_t CUR_RPC_VER = 1;
+  // Response whose log payload is compressed. It is only sent to CDC Connector
+  // which asks for compression, so CDC Connector of older version never sees it.
+  static const int64_t COMPRESSED_RPC_VER = 2;
 public:
   enum FeedbackType
   {
@@ -318,9 +330,19 @@ public:
   }
   bool is_valid() const
   {
-    return pos_ >= 0 && pos_ <= FETCH_BUF_LEN;
+    return pos_ >= 0 && pos_ <= FETCH_BUF_LEN
+        && raw_data_len_ >= 0 && raw_data_len_ <= FETCH_BUF_LEN;
   }
 
+  // For log payload compression
+  // 1. Server compresses the filled log payload in place after fetching log, the response
+  //    keeps raw payload if compression does not shrink it.
+  // 2. CDC Connector gets raw payload back through assign(), which decompresses it.
+  bool is_compressed() const { return COMPRESSED_RPC_VER == rpc_ver_; }
+  common::ObCompressorType get_compressor_type() const { return compressor_type_; }
+  int64_t get_raw_data_len() const { return is_compressed() ? raw_data_len_ : pos_; }
+  int compress_payload(const common::ObCompressorType compressor_type);
+
   TO_STRING_KV(
       K_(rpc_ver),
       K_(err),
@@ -330,12 +352,17 @@ public:
       K_(fetch_status),
       K_(next_req_lsn),
       K_(log_num),
-      K_(pos));
+      K_(pos),
+      K_(compressor_type),
+      K_(raw_data_len));
   OB_UNIS_VERSION(1);
 
 private:
   static const int64_t FETCH_BUF_LEN = palf::MAX_LOG_BUFFER_SIZE * 8;
 
+private:
+  int decompress_payload_(const ObCdcLSFetchLogResp &other);
+
 private:
   int64_t rpc_ver_;
   int err_;
@@ -346,6 +373,9 @@ private:
   LSN next_req_lsn_;
   int64_t log_num_;
   int64_t pos_;
+  // valid only when is_compressed()
+  common::ObCompressorType compressor_type_;
+  int64_t raw_data_len_;
   char log_entry_buf_[FETCH_BUF_LEN];
 
 private:
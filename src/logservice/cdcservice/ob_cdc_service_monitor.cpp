@@ -25,6 +25,7 @@ int64_t ObCdcServiceMonitor::l2s_time_;
 int64_t ObCdcServiceMonitor::svr_queue_time_;
 
 int64_t ObCdcServiceMonitor::fetch_size_;
+int64_t ObCdcServiceMonitor::compressed_size_;
 int64_t ObCdcServiceMonitor::fetch_log_count_;
 int64_t ObCdcServiceMonitor::reach_upper_ts_pkey_count_;
 int64_t ObCdcServiceMonitor::reach_max_log_pkey_count_;
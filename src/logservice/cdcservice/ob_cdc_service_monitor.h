@@ -34,6 +34,7 @@ public:
   inline static void svr_queue_time(const int64_t time) { (void)ATOMIC_AAF(&svr_queue_time_, time); }
 
   inline static void fetch_size(const int64_t size) { (void)ATOMIC_AAF(&fetch_size_, size); }
+  inline static void compressed_size(const int64_t size) { (void)ATOMIC_AAF(&compressed_size_, size); }
   inline static void fetch_log_count(const int64_t c) { (void)ATOMIC_AAF(&fetch_log_count_, c); }
   inline static void reach_upper_ts_pkey_count(const int64_t c) { (void)ATOMIC_AAF(&reach_upper_ts_pkey_count_, c); }
   inline static void reach_max_log_pkey_count(const int64_t c) { (void)ATOMIC_AAF(&reach_max_log_pkey_count_, c); }
@@ -52,6 +53,7 @@ public:
     ATOMIC_STORE(&svr_queue_time_, 0);
 
     ATOMIC_STORE(&fetch_size_, 0);
+    ATOMIC_STORE(&compressed_size_, 0);
     ATOMIC_STORE(&fetch_log_count_, 0);
     ATOMIC_STORE(&reach_upper_ts_pkey_count_, 0);
     ATOMIC_STORE(&reach_max_log_pkey_count_, 0);
@@ -66,13 +68,14 @@ public:
 
     _EXTLOG_LOG(INFO, "ObCdcServiceMonitor Report: "
                 "locate_count=%ld, locate_time=%ld, "
-                "fetch_count=%ld, fetch_size=%ld, fetch_log_count=%ld, "
+                "fetch_count=%ld, fetch_size=%ld, compressed_size=%ld, fetch_log_count=%ld, "
                 "l2s_time=%ld, svr_queue_time=%ld, fetch_time=%ld, "
                 "reach_upper_ts_pkey_count=%ld, "
                 "reach_max_log_pkey_count=%ld, need_fetch_pkey_count=%ld, "
                 "scan_round_count=%ld, round_rate=%ld",
                 ATOMIC_LOAD(&locate_count_), ATOMIC_LOAD(&locate_time_),
-                ATOMIC_LOAD(&fetch_count_), ATOMIC_LOAD(&fetch_size_), ATOMIC_LOAD(&fetch_log_count_),
+                ATOMIC_LOAD(&fetch_count_), ATOMIC_LOAD(&fetch_size_),
+                ATOMIC_LOAD(&compressed_size_), ATOMIC_LOAD(&fetch_log_count_),
                 ATOMIC_LOAD(&l2s_time_), ATOMIC_LOAD(&svr_queue_time_), ATOMIC_LOAD(&fetch_time_),
                 ATOMIC_LOAD(&reach_upper_ts_pkey_count_), ATOMIC_LOAD(&reach_max_log_pkey_count_), ATOMIC_LOAD(&need_fetch_pkey_count_),
                 ATOMIC_LOAD(&scan_round_count_), round_rate);
@@ -96,6 +99,7 @@ private:
 
   // fetch log efficiency
   static int64_t fetch_size_; // bytes
+  static int64_t compressed_size_; // bytes sent for compressed log payload
   static int64_t fetch_log_count_;
   static int64_t reach_upper_ts_pkey_count_;
   static int64_t reach_max_log_pkey_count_;
@@ -47,6 +47,24 @@ struct ObCDCError
 
 typedef void (* ERROR_CALLBACK) (const ObCDCError &err);
 
+/*
+ * Encoding of column value in ICDCRecord when enable_binary_row_output is on.
+ * The encoding is decided by the mysql type of column (IColMeta::getType()).
+ * Fixed-width value is stored in host byte order.
+ */
+enum ObCDCBinaryColumnEncoding
+{
+  CDC_BINARY_COL_TEXT = 0,      ///< text, same as enable_binary_row_output is off (decimal, json, geometry, oracle types...)
+  CDC_BINARY_COL_INT64,         ///< 8 bytes integer, signed or unsigned by IColMeta::isSigned() (integer, bit, enum, set)
+  CDC_BINARY_COL_FLOAT,         ///< 4 bytes float
+  CDC_BINARY_COL_DOUBLE,        ///< 8 bytes double
+  CDC_BINARY_COL_DATE,          ///< 4 bytes int32, days since 1970-01-01
+  CDC_BINARY_COL_DATETIME,      ///< 8 bytes int64, microseconds since 1970-01-01 (timestamp in UTC)
+  CDC_BINARY_COL_TIME,          ///< 8 bytes int64, microseconds
+  CDC_BINARY_COL_YEAR,          ///< 1 byte uint8, 0 for year 0000, otherwise year - 1900
+  CDC_BINARY_COL_BYTES,         ///< raw bytes of string and binary column, same as text output
+};
+
 class IObCDCInstance
 {
 public:
@@ -133,6 +151,13 @@ public:
   /// @retval OB_SUCCESS      success
   /// @retval other value     fail
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids) = 0;
+
+  /// get encoding of column value when enable_binary_row_output is on
+  ///
+  /// @param [in] mysql_type  column type, IColMeta::getType()
+  ///
+  /// @return encoding of column value, CDC_BINARY_COL_TEXT if column value is output as text
+  virtual ObCDCBinaryColumnEncoding get_binary_column_encoding(const int mysql_type) const = 0;
 };
 
 class ObCDCFactory
@@ -289,6 +289,11 @@ public:
 
   T_DEF_INT_INFT(fetch_log_rpc_timeout_sec, OB_CLUSTER_PARAMETER, 15, 1, "fetch log rpc timeout in seconds");
 
+  // Compressor of log payload in fetch log rpc response, negotiated with server per request.
+  // Server of older version ignores it and returns raw log.
+  // Recommended: none, lz4_1.0, zstd_1.3.8
+  DEF_STR(fetch_log_rpc_compressor, OB_CLUSTER_PARAMETER, "none", "fetch log rpc payload compressor");
+
   // Upper limit of progress difference between partitions, in seconds
   T_DEF_INT_INFT(progress_limit_sec_for_dml, OB_CLUSTER_PARAMETER, 300, 1, "dml progress limit in seconds");
 
@@ -489,6 +494,12 @@ public:
   // 2. When configured on, the timestamp field is synchronized to integer
   T_DEF_BOOL(enable_convert_timestamp_to_unix_timestamp, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // Whether to output column values of numeric and temporal types in binary format
+  // 1. off by default, all column values are converted to text
+  // 2. When configured on, fixed-width column values point to the native value without formatting,
+  //    see ObCDCBinaryColumnEncoding in libobcdc.h for the encoding of each column type
+  T_DEF_BOOL(enable_binary_row_output, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
+
   // Whether to output invisible columns externally
   // 1. DRC link is off by default; if valid, output hidden primary key
   // 2. Backup is on by default
@@ -510,6 +521,13 @@ public:
   // No printing by default
   T_DEF_BOOL(enable_formatter_print_log, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // Max statement count of one redo that formatted by one Formatter thread.
+  // Statements of a larger redo are split by table into batches of at most this count and
+  // formatted by different Formatter threads, output order is still restored by ObLogEntryTask.
+  // 0 means format all statements of one redo in one Formatter thread.
+  T_DEF_INT_INFT(formatter_batch_stmt_count, OB_CLUSTER_PARAMETER, 1000, 0,
+      "max statement count of one redo formatted by one formatter thread");
+
   // Switch: Whether to enable SSL authentication: including MySQL and RPC
   // Disabled by default
   T_DEF_BOOL(ssl_client_authentication, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
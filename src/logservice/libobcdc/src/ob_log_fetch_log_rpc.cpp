@@ -28,6 +28,7 @@
 #include "ob_log_ls_fetch_stream.h"       // FetchStream
 #include "ob_log_trace_id.h"              // ObLogTraceIdGuard
 #include "ob_log_config.h"                // ObLogConfig
+#include "lib/compress/ob_compressor_pool.h"  // ObCompressorPool
 
 using namespace oceanbase::common;
 using namespace oceanbase::obrpc;
@@ -245,15 +246,29 @@ int64_t FetchLogARpc::g_rpc_result_count_per_rpc_upper_limit =
 
 bool FetchLogARpc::g_print_rpc_handle_info = ObLogConfig::default_print_rpc_handle_info;
 
+common::ObCompressorType FetchLogARpc::g_compressor_type = common::NONE_COMPRESSOR;
+
 void FetchLogARpc::configure(const ObLogConfig &config)
 {
+  int tmp_ret = OB_SUCCESS;
   int64_t rpc_result_count_per_rpc_upper_limit = config.rpc_result_count_per_rpc_upper_limit;
   bool print_rpc_handle_info = config.print_rpc_handle_info;
+  const char *fetch_log_rpc_compressor = config.fetch_log_rpc_compressor.str();
+  common::ObCompressorType compressor_type = common::NONE_COMPRESSOR;
 
   ATOMIC_STORE(&g_rpc_result_count_per_rpc_upper_limit, rpc_result_count_per_rpc_upper_limit);
   LOG_INFO("[CONFIG]", K(rpc_result_count_per_rpc_upper_limit));
   ATOMIC_STORE(&g_print_rpc_handle_info, print_rpc_handle_info);
   LOG_INFO("[CONFIG]", K(print_rpc_handle_info));
+
+  if (OB_SUCCESS != (tmp_ret = common::ObCompressorPool::get_instance().get_compressor_type(
+      fetch_log_rpc_compressor, compressor_type))) {
+    LOG_WARN("invalid fetch_log_rpc_compressor, compression disabled", K(tmp_ret),
+        K(fetch_log_rpc_compressor));
+    compressor_type = common::NONE_COMPRESSOR;
+  }
+  ATOMIC_STORE(&g_compressor_type, compressor_type);
+  LOG_INFO("[CONFIG]", K(fetch_log_rpc_compressor), K(compressor_type));
 }
 
 const char *FetchLogARpc::print_rpc_stop_reason(const RpcStopReason reason)
@@ -1205,6 +1220,7 @@ int FetchLogARpc::RpcRequest::prepare(
     LOG_ERROR("invalid argument", KR(ret), K(req_start_lsn));
   } else {
     req_.set_client_pid(static_cast<uint64_t>(getpid()));
+    req_.set_compressor_type(ATOMIC_LOAD(&g_compressor_type));
 
     // set start lsn
     req_.set_start_lsn(req_start_lsn);
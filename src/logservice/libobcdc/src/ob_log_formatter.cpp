@@ -95,7 +95,8 @@ ObLogFormatter::ObLogFormatter() : inited_(false),
                                    hbase_util_(NULL),
                                    skip_hbase_mode_put_column_count_not_consistency_(false),
                                    enable_output_hidden_primary_key_(false),
-                                   log_entry_task_count_(0)
+                                   log_entry_task_count_(0),
+                                   batch_stmt_count_(0)
 
 {
 }
@@ -156,6 +157,7 @@ int ObLogFormatter::init(const int64_t thread_num,
     skip_hbase_mode_put_column_count_not_consistency_ = skip_hbase_mode_put_column_count_not_consistency;
     enable_output_hidden_primary_key_ = enable_output_hidden_primary_key;
     log_entry_task_count_ = 0;
+    batch_stmt_count_ = TCONF.formatter_batch_stmt_count;
     inited_ = true;
     LOG_INFO("Formatter init succ", K(working_mode_), "working_mode", print_working_mode(working_mode_),
         K(thread_num), K(queue_size));
@@ -187,6 +189,15 @@ void ObLogFormatter::destroy()
   skip_hbase_mode_put_column_count_not_consistency_ = false;
   enable_output_hidden_primary_key_ = false;
   log_entry_task_count_ = 0;
+  batch_stmt_count_ = 0;
+}
+
+void ObLogFormatter::configure(const ObLogConfig &cfg)
+{
+  int64_t formatter_batch_stmt_count = cfg.formatter_batch_stmt_count;
+
+  ATOMIC_STORE(&batch_stmt_count_, formatter_batch_stmt_count);
+  LOG_INFO("[CONFIG]", K(formatter_batch_stmt_count));
 }
 
 int ObLogFormatter::start()
@@ -224,14 +235,40 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
     LOG_ERROR("invalid arguments", K(stmt_task));
     ret = OB_INVALID_ARGUMENT;
   } else {
-    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue
-    const uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
+    // Statements of one ObLogEntryTask are pushed to the same queue unless the redo is large:
+    // 1. statements of a large redo are split into batches by table, each batch is pushed to
+    //    one queue so that the statements of one table are formatted by one thread as far as possible.
+    // 2. output order does not depend on which thread formats a statement, binlog records are linked
+    //    by the order of stmt_list when the last statement of ObLogEntryTask is formatted, see finish_format_.
+    // Note: the last pushed statement may finish the ObLogEntryTask, which can't be referenced after that.
+    const int64_t batch_stmt_count = ATOMIC_LOAD(&batch_stmt_count_);
+    const int64_t total_stmt_count = get_stmt_num_(*stmt_task);
+    const bool need_split = (batch_stmt_count > 0 && total_stmt_count > batch_stmt_count);
+    uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
+    uint64_t batch_table_id = common::OB_INVALID_ID;
+    int64_t batch_count = 0;
     int64_t stmt_count = 0;
 
     while (OB_SUCC(ret) && NULL != stmt_task) {
       IStmtTask *next = stmt_task->get_next();
       void *push_task = static_cast<void *>(stmt_task);
 
+      DmlStmtTask *dml_stmt_task = NULL;
+      // non-DML statement stays in the current batch
+      if (need_split
+          && stmt_task->is_dml_stmt()
+          && OB_NOT_NULL(dml_stmt_task = dynamic_cast<DmlStmtTask *>(stmt_task))) {
+        const uint64_t table_id = dml_stmt_task->get_table_id();
+
+        if (batch_count >= batch_stmt_count
+            || (batch_count > 0 && table_id != batch_table_id)) {
+          hash_value = ATOMIC_FAA(&round_value_, 1);
+          batch_count = 0;
+        }
+        batch_table_id = table_id;
+        ++batch_count;
+      }
+
       RETRY_FUNC(stop_flag, *(static_cast<ObMQThread *>(this)), push, push_task, hash_value, DATA_OP_TIMEOUT);
 
       if (OB_SUCC(ret)) {
@@ -252,6 +289,19 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
   return ret;
 }
 
+int64_t ObLogFormatter::get_stmt_num_(IStmtTask &stmt_task) const
+{
+  int64_t stmt_num = 0;
+  DmlStmtTask *dml_stmt_task = NULL;
+
+  // Only DML statements are pushed by DmlParser
+  if (stmt_task.is_dml_stmt() && OB_NOT_NULL(dml_stmt_task = dynamic_cast<DmlStmtTask *>(&stmt_task))) {
+    stmt_num = dml_stmt_task->get_redo_log_entry_task().get_stmt_num();
+  }
+
+  return stmt_num;
+}
+
 int ObLogFormatter::push_single_task(IStmtTask *stmt_task, volatile bool &stop_flag)
 {
   int ret = OB_SUCCESS;
@@ -38,6 +38,8 @@ class ObString;
 
 namespace libobcdc
 {
+class ObLogConfig;
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // IObLogFormatter
 
@@ -61,6 +63,7 @@ public:
   virtual int push(IStmtTask *task, volatile bool &stop_flag) = 0;
   virtual int push_single_task(IStmtTask *task, volatile bool &stop_flag) = 0;
   virtual int get_task_count(int64_t &br_count, int64_t &log_entry_task_count) = 0;
+  virtual void configure(const ObLogConfig &cfg) = 0;
 };
 
 
@@ -92,6 +95,7 @@ public:
   int push_single_task(IStmtTask *task, volatile bool &stop_flag);
   int get_task_count(int64_t &br_count,
       int64_t &log_entry_task_count);
+  void configure(const ObLogConfig &cfg);
   int handle(void *data, const int64_t thread_index, volatile bool &stop_flag);
 
 public:
@@ -135,6 +139,8 @@ private:
   static const int64_t DATA_OP_TIMEOUT = 1 * 1000 * 1000;
   static const int64_t PRINT_LOG_INTERVAL = 10 * 1000 * 1000;
 
+  // statement count of the ObLogEntryTask which stmt_task belongs to
+  int64_t get_stmt_num_(IStmtTask &stmt_task) const;
   void handle_non_full_columns_(DmlStmtTask &dml_stmt_task,
       const TableSchemaType &table_schema);
   int init_row_value_array_(const int64_t row_value_num);
@@ -259,6 +265,8 @@ private:
   bool                       skip_hbase_mode_put_column_count_not_consistency_;
   bool                       enable_output_hidden_primary_key_;
   int64_t                    log_entry_task_count_;
+  // max statement count of one redo formatted by one Formatter thread, see formatter_batch_stmt_count
+  int64_t                    batch_stmt_count_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogFormatter);
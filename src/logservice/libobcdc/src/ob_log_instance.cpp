@@ -721,6 +721,7 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   bool enable_backup_mode = (TCONF.enable_backup_mode != 0);
   bool skip_hbase_mode_put_column_count_not_consistency = (TCONF.skip_hbase_mode_put_column_count_not_consistency != 0);
   bool enable_convert_timestamp_to_unix_timestamp = (TCONF.enable_convert_timestamp_to_unix_timestamp != 0);
+  bool enable_binary_row_output = (TCONF.enable_binary_row_output != 0);
   bool enable_output_hidden_primary_key = (TCONF.enable_output_hidden_primary_key != 0);
   bool enable_oracle_mode_match_case_sensitive = (TCONF.enable_oracle_mode_match_case_sensitive != 0);
   const char *rs_list = TCONF.rootserver_list.str();
@@ -898,9 +899,9 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   // After initializing the timezone info getter successfully, initialize the obj2str_helper_
   if (OB_SUCC(ret)) {
     if (OB_FAIL(obj2str_helper_.init(*timezone_info_getter_, hbase_util_, enable_hbase_mode,
-            enable_convert_timestamp_to_unix_timestamp, enable_backup_mode, *tenant_mgr_))) {
+            enable_convert_timestamp_to_unix_timestamp, enable_backup_mode, enable_binary_row_output, *tenant_mgr_))) {
       LOG_ERROR("init obj2str_helper fail", KR(ret), K(enable_hbase_mode),
-          K(enable_convert_timestamp_to_unix_timestamp), K(enable_backup_mode));
+          K(enable_convert_timestamp_to_unix_timestamp), K(enable_backup_mode), K(enable_binary_row_output));
     }
   }
 
@@ -1258,6 +1259,11 @@ int ObLogInstance::get_tenant_ids(std::vector<uint64_t> &tenant_ids)
   return ret;
 }
 
+ObCDCBinaryColumnEncoding ObLogInstance::get_binary_column_encoding(const int mysql_type) const
+{
+  return ObObj2strHelper::get_binary_column_encoding(static_cast<obmysql::EMySQLFieldType>(mysql_type));
+}
+
 void ObLogInstance::mark_stop_flag()
 {
   if (inited_) {
@@ -2011,6 +2017,11 @@ void ObLogInstance::reload_config_()
     if (OB_NOT_NULL(trans_redo_dispatcher_)) {
       trans_redo_dispatcher_->configure(config);
     }
+    // config formatter
+    if (OB_NOT_NULL(formatter_)) {
+      formatter_->configure(config);
+    }
+
     // config sequencer
     if (OB_NOT_NULL(sequencer_)) {
       sequencer_->configure(config);
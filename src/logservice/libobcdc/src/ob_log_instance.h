@@ -136,6 +136,7 @@ public:
   virtual int launch();
   virtual void stop();
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids);
+  virtual ObCDCBinaryColumnEncoding get_binary_column_encoding(const int mysql_type) const;
 
 public:
   void mark_stop_flag();
@@ -1669,7 +1669,8 @@ ObLogEntryTask::ObLogEntryTask() :
     stmt_list_(),
     formatted_stmt_num_(0),
     row_ref_cnt_(0),
-    arena_allocator_("LogEntryTask", OB_MALLOC_MIDDLE_BLOCK_SIZE)
+    arena_allocator_("LogEntryTask", OB_MALLOC_MIDDLE_BLOCK_SIZE),
+    safe_allocator_(arena_allocator_)
 {
 }
 
@@ -1690,7 +1691,7 @@ void ObLogEntryTask::reset()
   formatted_stmt_num_ = 0;
   row_ref_cnt_ = 0;
 
-  arena_allocator_.clear();
+  safe_allocator_.clear();
 }
 
 bool ObLogEntryTask::is_valid() const
@@ -1812,7 +1813,7 @@ void *ObLogEntryTask::alloc(const int64_t size)
   void *alloc_ret = NULL;
 
   if (size > 0) {
-    alloc_ret = arena_allocator_.alloc(size);
+    alloc_ret = safe_allocator_.alloc(size);
   }
 
   return alloc_ret;
@@ -1821,7 +1822,7 @@ void *ObLogEntryTask::alloc(const int64_t size)
 // NOTE: For ObArenaAllocator: virtual void free(void *ptr) do nothing
 void ObLogEntryTask::free(void *ptr)
 {
-  arena_allocator_.free(ptr);
+  safe_allocator_.free(ptr);
   ptr = NULL;
 }
 
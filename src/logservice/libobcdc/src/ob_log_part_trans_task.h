@@ -646,7 +646,9 @@ public:
 
   int get_valid_row_num(int64_t &valid_row_num);
 
-  common::ObIAllocator &get_allocator() { return arena_allocator_; }
+  // statements of one ObLogEntryTask may be formatted by several Formatter threads concurrently,
+  // so the allocator shared by them must be thread safe
+  common::ObIAllocator &get_allocator() { return safe_allocator_; }
   void *alloc(const int64_t size);
   void free(void *ptr);
 
@@ -704,8 +706,11 @@ private:
   int64_t            row_ref_cnt_;          // reference count
 
   // Non-thread safe allocator
-  // used for Parser/Formatter
+  // only accessed through safe_allocator_
   common::ObArenaAllocator arena_allocator_;          // allocator
+  // thread safe wrapper of arena_allocator_
+  // used for Parser/Formatter
+  common::ObSafeArenaAllocator safe_allocator_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogEntryTask);
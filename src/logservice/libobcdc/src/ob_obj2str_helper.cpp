@@ -24,6 +24,7 @@
 #include "sql/engine/expr/ob_expr_uuid.h"
 #include "sql/engine/expr/ob_expr_operator.h"
 #include "sql/engine/expr/ob_expr_res_type_map.h"
+#include "observer/mysql/obsm_utils.h"              // ObSMUtils
 
 #include "ob_log_utils.h"                           // _M_
 
@@ -40,6 +41,7 @@ ObObj2strHelper::ObObj2strHelper() : inited_(false),
                                      enable_hbase_mode_(false),
                                      enable_convert_timestamp_to_unix_timestamp_(false),
                                      enable_backup_mode_(false),
+                                     enable_binary_row_output_(false),
                                      tenant_mgr_(NULL)
 {
 }
@@ -54,12 +56,18 @@ int ObObj2strHelper::init(IObLogTimeZoneInfoGetter &timezone_info_getter,
     const bool enable_hbase_mode,
     const bool enable_convert_timestamp_to_unix_timestamp,
     const bool enable_backup_mode,
+    const bool enable_binary_row_output,
     IObLogTenantMgr &tenant_mgr)
 {
   int ret = OB_SUCCESS;
 
   if (inited_) {
     ret = OB_INIT_TWICE;
+  } else if (OB_UNLIKELY(enable_binary_row_output && enable_hbase_mode && ! enable_backup_mode)) {
+    // hbase table T column is converted to positive in text format
+    ret = OB_NOT_SUPPORTED;
+    OBLOG_LOG(ERROR, "binary row output is not supported in hbase mode", KR(ret), K(enable_binary_row_output),
+        K(enable_hbase_mode), K(enable_backup_mode));
   } else if (OB_FAIL(init_ob_charset_utils())) {
     OBLOG_LOG(ERROR, "failed to init ob charset util!", KR(ret));
   } else {
@@ -68,6 +76,7 @@ int ObObj2strHelper::init(IObLogTimeZoneInfoGetter &timezone_info_getter,
     enable_hbase_mode_ = enable_hbase_mode;
     enable_convert_timestamp_to_unix_timestamp_ = enable_convert_timestamp_to_unix_timestamp;
     enable_backup_mode_ = enable_backup_mode;
+    enable_binary_row_output_ = enable_binary_row_output;
     tenant_mgr_ = &tenant_mgr;
     inited_ = true;
   }
@@ -104,9 +113,88 @@ void ObObj2strHelper::destroy()
   enable_hbase_mode_ = false;
   enable_convert_timestamp_to_unix_timestamp_ = false;
   enable_backup_mode_ = false;
+  enable_binary_row_output_ = false;
   tenant_mgr_ = NULL;
 }
 
+ObCDCBinaryColumnEncoding ObObj2strHelper::get_binary_column_encoding(const obmysql::EMySQLFieldType mysql_type)
+{
+  ObCDCBinaryColumnEncoding encoding = CDC_BINARY_COL_TEXT;
+
+  switch (mysql_type) {
+    case obmysql::MYSQL_TYPE_TINY:
+    case obmysql::MYSQL_TYPE_SHORT:
+    case obmysql::MYSQL_TYPE_INT24:
+    case obmysql::MYSQL_TYPE_LONG:
+    case obmysql::MYSQL_TYPE_LONGLONG:
+    case obmysql::MYSQL_TYPE_BIT:
+    case obmysql::MYSQL_TYPE_ENUM:
+    case obmysql::MYSQL_TYPE_SET:
+      encoding = CDC_BINARY_COL_INT64;
+      break;
+    case obmysql::MYSQL_TYPE_FLOAT:
+    case obmysql::MYSQL_TYPE_ORA_BINARY_FLOAT:
+      encoding = CDC_BINARY_COL_FLOAT;
+      break;
+    case obmysql::MYSQL_TYPE_DOUBLE:
+    case obmysql::MYSQL_TYPE_ORA_BINARY_DOUBLE:
+      encoding = CDC_BINARY_COL_DOUBLE;
+      break;
+    case obmysql::MYSQL_TYPE_DATE:
+      encoding = CDC_BINARY_COL_DATE;
+      break;
+    case obmysql::MYSQL_TYPE_DATETIME:
+    case obmysql::MYSQL_TYPE_TIMESTAMP:
+      encoding = CDC_BINARY_COL_DATETIME;
+      break;
+    case obmysql::MYSQL_TYPE_TIME:
+      encoding = CDC_BINARY_COL_TIME;
+      break;
+    case obmysql::MYSQL_TYPE_YEAR:
+      encoding = CDC_BINARY_COL_YEAR;
+      break;
+    case obmysql::MYSQL_TYPE_VARCHAR:
+    case obmysql::MYSQL_TYPE_VAR_STRING:
+    case obmysql::MYSQL_TYPE_STRING:
+    case obmysql::MYSQL_TYPE_TINY_BLOB:
+    case obmysql::MYSQL_TYPE_MEDIUM_BLOB:
+    case obmysql::MYSQL_TYPE_LONG_BLOB:
+    case obmysql::MYSQL_TYPE_BLOB:
+    case obmysql::MYSQL_TYPE_OB_RAW:
+      encoding = CDC_BINARY_COL_BYTES;
+      break;
+    default:
+      // decimal, json, geometry, oracle temporal and lob types are output as text
+      encoding = CDC_BINARY_COL_TEXT;
+      break;
+  }
+
+  return encoding;
+}
+
+ObCDCBinaryColumnEncoding ObObj2strHelper::get_binary_column_encoding(const common::ObObjType obj_type)
+{
+  ObCDCBinaryColumnEncoding encoding = CDC_BINARY_COL_TEXT;
+  obmysql::EMySQLFieldType mysql_type = obmysql::MYSQL_TYPE_NOT_DEFINED;
+  uint16_t type_flag = 0;
+  ObScale decimals = 0;
+
+  // keep same with ObLogMetaManager::set_column_meta_
+  if (ObEnumType == obj_type) {
+    mysql_type = obmysql::MYSQL_TYPE_ENUM;
+  } else if (ObSetType == obj_type) {
+    mysql_type = obmysql::MYSQL_TYPE_SET;
+  } else if (OB_SUCCESS != ObSMUtils::get_mysql_type(obj_type, mysql_type, type_flag, decimals)) {
+    mysql_type = obmysql::MYSQL_TYPE_NOT_DEFINED;
+  }
+
+  if (obmysql::MYSQL_TYPE_NOT_DEFINED != mysql_type) {
+    encoding = get_binary_column_encoding(mysql_type);
+  }
+
+  return encoding;
+}
+
 
 //extended_type_info used for enum/set
 int ObObj2strHelper::obj2str(const uint64_t tenant_id,
@@ -126,8 +214,15 @@ int ObObj2strHelper::obj2str(const uint64_t tenant_id,
   common::ObObjTypeClass obj_tc = common::ob_obj_type_class(obj_type);
   lib::Worker::CompatMode compat_mode = THIS_WORKER.get_compatibility_mode();
 
+  bool is_binary_converted = false;
+
+  if (enable_binary_row_output_ && common::ObNullTC != obj_tc
+      && OB_FAIL(convert_obj_to_binary_(obj, str, allocator, string_deep_copy, is_binary_converted))) {
+    OBLOG_LOG(ERROR, "convert_obj_to_binary_ fail", KR(ret), K(table_id), K(column_id), K(obj), K(obj_type));
+  } else if (is_binary_converted) {
+    // done
   // Configure allowed conversions: mysql timestamp column -> UTC integer time
-  if (ObTimestampType == obj_type && enable_convert_timestamp_to_unix_timestamp_) {
+  } else if (ObTimestampType == obj_type && enable_convert_timestamp_to_unix_timestamp_) {
     if (OB_FAIL(convert_mysql_timestamp_to_utc_(obj, str, allocator))) {
       OBLOG_LOG(ERROR, "convert_mysql_timestamp_to_utc_ fail", KR(ret), K(table_id), K(column_id), K(obj), K(obj_type),
           K(str));
@@ -501,5 +596,67 @@ int ObObj2strHelper::convert_char_obj_to_padding_obj_(const lib::Worker::CompatM
   return ret;
 }
 
+int ObObj2strHelper::convert_obj_to_binary_(const common::ObObj &obj,
+    common::ObString &str,
+    common::ObIAllocator &allocator,
+    const bool deep_copy,
+    bool &is_converted) const
+{
+  int ret = OB_SUCCESS;
+  int64_t value_len = 0;
+  is_converted = false;
+
+  switch (get_binary_column_encoding(obj.get_type())) {
+    case CDC_BINARY_COL_INT64:
+    case CDC_BINARY_COL_DOUBLE:
+    case CDC_BINARY_COL_DATETIME:
+    case CDC_BINARY_COL_TIME:
+      // int/uint/bit/enum/set value is stored in 8 bytes
+      value_len = sizeof(int64_t);
+      break;
+    case CDC_BINARY_COL_FLOAT:
+      value_len = sizeof(float);
+      break;
+    case CDC_BINARY_COL_DATE:
+      value_len = sizeof(int32_t);
+      break;
+    case CDC_BINARY_COL_YEAR:
+      value_len = sizeof(uint8_t);
+      break;
+    default:
+      // text and bytes, convert as before
+      value_len = 0;
+      break;
+  }
+
+  if (value_len > 0) {
+    const char *value_ptr = static_cast<const char *>(obj.get_data_ptr());
+
+    if (OB_ISNULL(value_ptr)) {
+      ret = OB_ERR_UNEXPECTED;
+      OBLOG_LOG(ERROR, "data ptr of obj is null", KR(ret), K(obj));
+    } else if (deep_copy) {
+      char *buf = static_cast<char *>(allocator.alloc(value_len));
+
+      if (OB_ISNULL(buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        OBLOG_LOG(ERROR, "allocate memory fail", KR(ret), K(value_len));
+      } else {
+        MEMCPY(buf, value_ptr, value_len);
+        str.assign_ptr(buf, static_cast<ObString::obstr_size_t>(value_len));
+      }
+    } else {
+      // refer to value of the original object directly
+      str.assign_ptr(value_ptr, static_cast<ObString::obstr_size_t>(value_len));
+    }
+
+    if (OB_SUCC(ret)) {
+      is_converted = true;
+    }
+  }
+
+  return ret;
+}
+
 } // namespace libobcdc
 } // namespace oceanbase
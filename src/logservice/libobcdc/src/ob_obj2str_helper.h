@@ -21,6 +21,8 @@
 #include "lib/worker.h"                     // Worker
 #include "common/object/ob_obj_type.h"      // ObObjTypeClass
 #include "share/object/ob_obj_cast.h"       // ObObjCastParams, ObObjCaster
+#include "rpc/obmysql/ob_mysql_global.h"    // EMySQLFieldType
+#include "libobcdc.h"                       // ObCDCBinaryColumnEncoding
 #include "ob_log_hbase_mode.h"              // ObLogHbaseUtil
 #include "ob_log_tenant_mgr.h"              // ObLogTenantMgr
 
@@ -49,6 +51,11 @@ public:
   //  2) string_deep_copy == true
   //    deep copy of the string
   // 2. otherwise use allocator to allocate memory and print the object into memory
+  // 3. If enable_binary_row_output, object of fixed-width type is output in binary format, see ObCDCBinaryColumnEncoding
+  //  1) string_deep_copy == false
+  //    the string points directly to the value of the original object
+  //  2) string_deep_copy == true
+  //    deep copy of the value
    int obj2str(const uint64_t tenant_id,
        const uint64_t table_id,
        const uint64_t column_id,
@@ -67,9 +74,16 @@ public:
       const bool enable_hbase_mode,
       const bool enable_convert_timestamp_to_unix_timestamp,
       const bool enable_backup_mode,
+      const bool enable_binary_row_output,
       IObLogTenantMgr &tenant_mgr);
   void destroy();
 
+public:
+  // Encoding of column value with the mysql type in binary row output
+  static ObCDCBinaryColumnEncoding get_binary_column_encoding(const obmysql::EMySQLFieldType mysql_type);
+  // Encoding of object with the ob type in binary row output, consistent with mysql type in column meta
+  static ObCDCBinaryColumnEncoding get_binary_column_encoding(const common::ObObjType obj_type);
+
 public:
   static const char *EMPTY_STRING;
 
@@ -120,6 +134,14 @@ private:
       common::ObString &str,
       common::ObIAllocator &allocator) const;
 
+  // output fixed-width object in binary format
+  // is_converted == false if object should be output as text or bytes
+  int convert_obj_to_binary_(const common::ObObj &obj,
+      common::ObString &str,
+      common::ObIAllocator &allocator,
+      const bool deep_copy,
+      bool &is_converted) const;
+
 private:
   bool                          inited_;
   IObLogTimeZoneInfoGetter      *timezone_info_getter_;
@@ -127,6 +149,7 @@ private:
   bool                          enable_hbase_mode_;
   bool                          enable_convert_timestamp_to_unix_timestamp_;
   bool                          enable_backup_mode_;
+  bool                          enable_binary_row_output_;
   IObLogTenantMgr               *tenant_mgr_;
 
 private:
@@ -1236,6 +1236,8 @@ typedef enum ObItemType
   T_TABLE_PARALLEL,
   T_NO_PARALLEL,
   T_MONITOR,
+  T_RESULT_CACHE,
+  T_NO_RESULT_CACHE,
   T_PQ_DISTRIBUTE,
   T_PQ_DISTRIBUTE_WINDOW,
   T_PQ_SET,
@@ -20,6 +20,7 @@
 #include "rpc/obmysql/packet/ompk_eof.h"
 #include "rpc/obmysql/ob_mysql_request_utils.h"
 #include "rpc/obmysql/ob_poc_sql_request_operator.h"
+#include "lib/compress/ob_compressor_pool.h"
 #include "sql/session/ob_sql_session_mgr.h"
 #include "observer/mysql/obmp_utils.h"
 #include "observer/mysql/ob_mysql_result_set.h"
@@ -127,6 +128,7 @@ int ObMPPacketSender::clone_from(ObMPPacketSender& that)
   } else {
     comp_context_.is_checksum_off_ = that.comp_context_.is_checksum_off_;
     proto20_context_.is_checksum_off_ = that.proto20_context_.is_checksum_off_;
+    proto20_context_.compressor_ = that.proto20_context_.compressor_;
   }
   return ret;
 }
@@ -172,12 +174,46 @@ int ObMPPacketSender::do_init(rpc::ObRequest *req,
       proto20_context_.next_step_ = START_TO_FILL_STEP;
       proto20_context_.is_checksum_off_ = false;
       proto20_context_.is_new_extra_info_ = conn->proxy_cap_flags_.is_new_extra_info_support();
+      proto20_context_.compressor_ = get_proto20_compressor(*conn);
     }
     nio_protocol_ = req_->get_nio_protocol();
   }
   return ret;
 }
 
+// compressor configured by _ob20_compress_func, used only when client
+// announced it can decompress with it
+ObCompressor *ObMPPacketSender::get_proto20_compressor(const ObSMConnection &conn)
+{
+  ObCompressor *compressor = NULL;
+  ObCompressorType type = INVALID_COMPRESSOR;
+  bool is_supported = false;
+  if (!conn.proxy_cap_flags_.is_ob20_lz4_compress_support()
+      && !conn.proxy_cap_flags_.is_ob20_zstd_compress_support()) {
+    // client can't decompress
+  } else if (OB_SUCCESS != ObCompressorPool::get_instance().get_compressor_type(
+                               GCONF._ob20_compress_func, type)) {
+    // use no compress
+  } else {
+    switch (type) {
+      case LZ4_COMPRESSOR:
+        is_supported = conn.proxy_cap_flags_.is_ob20_lz4_compress_support();
+        break;
+      case ZSTD_COMPRESSOR:
+      case ZSTD_1_3_8_COMPRESSOR:
+        is_supported = conn.proxy_cap_flags_.is_ob20_zstd_compress_support();
+        break;
+      default:
+        break;
+    }
+    if (is_supported
+        && OB_SUCCESS != ObCompressorPool::get_instance().get_compressor(type, compressor)) {
+      compressor = NULL;
+    }
+  }
+  return compressor;
+}
+
 int ObMPPacketSender::alloc_ezbuf()
 {
   int ret = OB_SUCCESS;
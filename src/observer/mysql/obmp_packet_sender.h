@@ -163,6 +163,7 @@ private:
                           const bool is_last);
   bool need_flush_buffer() const;
   int resize_ezbuf(const int64_t size);
+  static common::ObCompressor *get_proto20_compressor(const ObSMConnection &conn);
 protected:
   rpc::ObRequest *req_;
   uint8_t seq_;
@@ -1447,6 +1447,7 @@ int ObServer::init_pre_setting()
     OB_LOGGER.set_log_warn(log_warn);
     LOG_INFO("Whether log warn", K(log_warn));
     OB_LOGGER.set_enable_async_log(enable_async_syslog);
+    OB_LOGGER.set_enable_log_shedding(config_._enable_syslog_shedding);
     LOG_INFO("init log config", K(record_old_log_file), K(log_warn), K(enable_async_syslog));
     if (0 == max_log_cnt) {
       LOG_INFO("won't recycle log file");
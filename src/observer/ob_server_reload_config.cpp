@@ -17,6 +17,7 @@
 #include "lib/alloc/ob_malloc_allocator.h"
 #include "lib/allocator/ob_tc_malloc.h"
 #include "lib/allocator/ob_mem_leak_checker.h"
+#include "lib/profile/ob_cpu_profiler.h"
 #include "share/scheduler/ob_dag_scheduler.h"
 #include "rpc/obrpc/ob_rpc_handler.h"
 #include "share/ob_cluster_version.h"
@@ -275,6 +276,13 @@ int ObServerReloadConfig::operator()()
   {
     ObSysVariables::set_value("datadir", GCONF.data_dir);
   }
+
+  {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_TMP_FAIL(ObCpuProfiler::get_instance().set_frequency(GCONF._cpu_profile_frequency))) {
+      LOG_WARN("set cpu profile frequency failed", KR(tmp_ret));
+    }
+  }
   return real_ret;
 }
 
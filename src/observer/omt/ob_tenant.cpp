@@ -584,6 +584,7 @@ ObTenant::ObTenant(const int64_t id,
       last_calibrate_token_ts_(0),
       last_pop_normal_cnt_(0),
       nesting_worker_has_init_(MULTI_LEVEL_THRESHOLD),
+      blocking_workers_(0),
       stopped_(true),
       wait_mtl_finished_(false),
       req_queue_(),
@@ -1023,6 +1024,37 @@ int64_t ObTenant::worker_count_bound() const
   return bound;
 }
 
+int64_t ObTenant::effective_token_cnt() const
+{
+  const int64_t token_cnt = token_cnt_;
+  const int64_t blocking = ATOMIC_LOAD(&blocking_workers_);
+  return std::max(token_cnt, std::min(token_cnt + blocking, worker_count_bound()));
+}
+
+void ObTenant::on_worker_block()
+{
+  int ret = OB_SUCCESS;
+  ATOMIC_INC(&blocking_workers_);
+  // activate another worker at once rather than waiting for next
+  // timeup, the wait may be much shorter than a time slice.
+  if (effective_token_cnt() > ass_token_cnt_ && OB_SUCC(workers_lock_.trylock())) {
+    const auto diff = effective_token_cnt() - ass_token_cnt_;
+    if (diff > 0) {
+      int64_t succ_num = 0L;
+      acquire_more_worker(diff, succ_num);
+      ass_token_cnt_ += succ_num;
+    }
+    IGNORE_RETURN workers_lock_.unlock();
+  }
+}
+
+void ObTenant::on_worker_unblock()
+{
+  // surplus workers would be set inactive in check_worker_count(w)
+  // once they have finished current request.
+  ATOMIC_DEC(&blocking_workers_);
+}
+
 int ObTenant::get_new_request(
     ObThWorker &w,
     int64_t timeout,
@@ -1474,7 +1506,7 @@ int ObTenant::check_worker_count()
     }
     actives_ = active_workers;
 
-    const auto diff = token_cnt_ - ass_token_cnt_;
+    const auto diff = effective_token_cnt() - ass_token_cnt_;
     if (diff > 0) {
       int64_t succ_num = 0L;
       acquire_more_worker(diff, succ_num);
@@ -1519,9 +1551,10 @@ int ObTenant::check_worker_count(ObThWorker &w)
     IGNORE_RETURN workers_lock_.unlock();
     LOG_WARN("thread acquire nesting worker", K(w.get_tidx()), K(nesting_worker_has_init_));
   }
-  if (ass_token_cnt_ != token_cnt_ &&
+  const auto token_cnt = effective_token_cnt();
+  if (ass_token_cnt_ != token_cnt &&
       OB_SUCC(workers_lock_.trylock())) {
-    const auto diff = token_cnt_ - ass_token_cnt_;
+    const auto diff = effective_token_cnt() - ass_token_cnt_;
     int tmp_ret = OB_SUCCESS;
     // ass_token_cnt_ maybe change before having acquired lock so we
     // check diff once more.
@@ -447,6 +447,11 @@ public:
   void set_sug_token(const int64_t token);
   int64_t token_cnt() const;
   int64_t sug_token_cnt() const;
+  // Called by worker before/after blocking on io or rpc. Blocked workers
+  // don't consume cpu, tenant would activate as many workers as blocked
+  // ones so that token_cnt_ workers keep runnable.
+  void on_worker_block();
+  void on_worker_unblock();
   lib::Worker::CompatMode get_compat_mode() const;
   share::ObTenantSpace &ctx();
 
@@ -486,6 +491,7 @@ public:
                K_(unit_min_cpu), K_(unit_max_cpu), K_(slice),
                K_(slice_remain), K_(token_cnt), K_(sug_token_cnt),
                K_(ass_token_cnt),
+               K_(blocking_workers),
                K_(lq_tokens),
                K_(used_lq_tokens),
                K_(stopped), K_(idle_us),
@@ -567,6 +573,8 @@ private:
   void release_lq_token();
 
   int64_t worker_count_bound() const;
+  // token count including those handed over by blocking workers
+  int64_t effective_token_cnt() const;
 
   inline void pause_it(ObThWorker &w);
   inline void resume_it(ObThWorker &w);
@@ -617,6 +625,8 @@ protected:
   int64_t last_calibrate_token_ts_;
   int64_t last_pop_normal_cnt_;
   int nesting_worker_has_init_;
+  // number of workers which hand their tokens over while blocking on io/rpc
+  int64_t blocking_workers_;
 
   bool stopped_;
   bool wait_mtl_finished_;
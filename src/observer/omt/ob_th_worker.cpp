@@ -21,6 +21,7 @@
 #include "lib/allocator/ob_page_manager.h"
 #include "lib/rc/context.h"
 #include "lib/thread/ob_thread_name.h"
+#include "lib/cpu/ob_cpu_topology.h"
 #include "ob_tenant.h"
 #include "ob_worker_processor.h"
 #include "share/config/ob_server_config.h"
@@ -52,8 +53,10 @@ ObThWorker::ObThWorker()
       query_start_time_(0), last_check_time_(0),
       can_retry_(true), need_retry_(false),
       active_(false), waiting_active_(false),
-      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false)
+      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false),
+      numa_node_(-1), numa_bind_failed_node_(-1), blocking_(false)
 {
+  CPU_ZERO(&origin_cpu_set_);
 }
 
 ObThWorker::~ObThWorker()
@@ -129,6 +132,10 @@ void ObThWorker::wait_active()
       has_reset_pm = true;
     }
     waiting_active_ = true;
+    if (-1 != numa_node_) {
+      // free worker may be acquired by any tenant
+      update_numa_binding();
+    }
     share::ObTenantEnv::set_tenant(nullptr);
     lib::set_thread_name("OMT_FREE_", NULL == tenant_ ? 0 : tenant_->id());
     serving_tenant_id = 0;
@@ -268,6 +275,36 @@ ObThWorker::Status ObThWorker::check_wait()
   return st;
 }
 
+bool ObThWorker::sched_wait()
+{
+  // only normal workers of tenant queue are taken into account, workers
+  // of resource group and nesting workers have their own token counting.
+  if (!blocking_
+      && OB_NOT_NULL(tenant_)
+      && OB_ISNULL(group_)
+      && 0 == get_worker_level()
+      && has_req_flag()
+      && GCONF._enable_blocking_worker_handoff) {
+    blocking_ = true;
+    tenant_->on_worker_block();
+  }
+  return true;
+}
+
+bool ObThWorker::sched_run(int64_t waittime)
+{
+  end_blocking();
+  return Worker::sched_run(waittime);
+}
+
+void ObThWorker::end_blocking()
+{
+  if (OB_UNLIKELY(blocking_)) {
+    blocking_ = false;
+    tenant_->on_worker_unblock();
+  }
+}
+
 inline void ObThWorker::process_request(rpc::ObRequest &req)
 {
   // reset retry flags
@@ -332,6 +369,8 @@ inline void ObThWorker::process_request(rpc::ObRequest &req)
             get_allocator().used(),
             pm_hold);
   }
+  // unpaired sched_wait, take the token back anyway
+  end_blocking();
   set_req_flag(false);
 }
 
@@ -348,6 +387,44 @@ void ObThWorker::set_th_worker_thread_name(uint64_t tenant_id)
   }
 }
 
+void ObThWorker::update_numa_binding()
+{
+  int ret = OB_SUCCESS;
+  int64_t numa_node = -1;
+  const int64_t numa_node_count = get_numa_node_count();
+  if (!waiting_active_ && OB_NOT_NULL(tenant_) && GCONF._enable_numa_aware && numa_node_count > 1
+      && (is_user_tenant(tenant_->id()) || is_meta_tenant(tenant_->id()))) {
+    // meta tenant is placed with its user tenant, user tenant ids are even
+    numa_node = (gen_user_tenant_id(tenant_->id()) / 2) % numa_node_count;
+  }
+  if (numa_node == numa_node_ || (-1 != numa_node && numa_node == numa_bind_failed_node_)) {
+    // binding is not changed, or binding to this node failed before (e.g. excluded by the
+    // cpuset of tenant cgroup), don't retry the syscall for every request.
+  } else if (-1 == numa_node_ && OB_FAIL(get_thread_cpu_affinity(origin_cpu_set_))) {
+    numa_bind_failed_node_ = numa_node;
+    LOG_WARN("get worker cpu affinity failed", K(ret), K(numa_node));
+  } else if (-1 == numa_node) {
+    // restore the affinity before binding
+    if (OB_FAIL(set_thread_cpu_affinity(origin_cpu_set_))) {
+      LOG_WARN("restore worker cpu affinity failed", K(ret), K_(numa_node));
+    }
+    numa_node_ = -1;
+  } else if (OB_FAIL(bind_thread_to_numa_node(numa_node, origin_cpu_set_))) {
+    LOG_WARN("bind worker to numa node failed", K(ret), K(numa_node), K_(numa_node));
+    numa_bind_failed_node_ = numa_node;
+    if (-1 != numa_node_) {
+      // don't stay on the node of the previous tenant
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = set_thread_cpu_affinity(origin_cpu_set_))) {
+        LOG_WARN("restore worker cpu affinity failed", K(tmp_ret), K_(numa_node));
+      }
+      numa_node_ = -1;
+    }
+  } else {
+    numa_node_ = numa_node;
+  }
+}
+
 void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t &worker_level)
 {
   int ret = OB_SUCCESS;
@@ -380,6 +457,7 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
           GCTX.cgroup_ctrl_->add_thread_to_cgroup(get_tid(), tenant_->id(), get_group_id());
           has_add_to_cgroup_ = true;
         }
+        update_numa_binding();
         if (OB_LIKELY(pm != nullptr)) {
           if (pm->get_used() != 0) {
             LOG_ERROR("page manager's used should be 0, unexpected!!!", KP(pm));
@@ -14,6 +14,7 @@
 #define _OCEABASE_OBSERVER_OMT_OB_TH_WORKER_H_
 
 #include <pthread.h>
+#include <sched.h>
 #include "lib/worker.h"
 #include "lib/lock/ob_thread_cond.h"
 #include "rpc/ob_request.h"
@@ -71,6 +72,13 @@ public:
   virtual int check_status() override;
   virtual int check_large_query_quota();
 
+  // hand the cpu token over to another worker of the tenant while
+  // blocking on io or rpc, and take it back when the wait is done.
+  virtual bool sched_wait() override;
+  virtual bool sched_run(int64_t waittime=0) override;
+  // take back the token handed over in sched_wait, if any
+  void end_blocking();
+
   // retry relating
   virtual bool can_retry() const;
   virtual void set_need_retry();
@@ -102,6 +110,8 @@ private:
   virtual void disable_retry();
 
   void set_th_worker_thread_name(uint64_t tenant_id);
+  // bind the worker to the numa node of the tenant if numa aware is enabled
+  void update_numa_binding();
   void wait_runnable();
   void process_request(rpc::ObRequest &req);
 
@@ -142,6 +152,14 @@ private:
   int64_t active_inactive_ts_;
   bool lq_token_;
   bool has_add_to_cgroup_;
+  // numa node which the thread is bound to, -1 if not bound
+  int64_t numa_node_;
+  // numa node which failed to bind last time, -1 if none
+  int64_t numa_bind_failed_node_;
+  // cpu affinity of the thread before it is bound to numa node
+  cpu_set_t origin_cpu_set_;
+  // whether the worker has handed its token over in sched_wait
+  bool blocking_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObThWorker);
@@ -161,6 +179,7 @@ inline void ObThWorker::reset()
   need_retry_ = false;
   active_ = false;
   has_add_to_cgroup_ = false;
+  blocking_ = false;
   unset_tidx();
 }
 
@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SERVER
+#include "observer/virtual_table/ob_all_virtual_cpu_profile.h"
+#include "lib/profile/ob_trace_id.h"
+
+using namespace oceanbase::common;
+
+namespace oceanbase
+{
+namespace observer
+{
+
+ObAllVirtualCpuProfile::ObAllVirtualCpuProfile()
+  : ObVirtualTableScannerIterator(),
+    addr_(),
+    ipstr_(),
+    port_(0),
+    entry_idx_(0)
+{
+  server_ip_[0] = '\0';
+  trace_id_[0] = '\0';
+  stack_[0] = '\0';
+}
+
+ObAllVirtualCpuProfile::~ObAllVirtualCpuProfile()
+{
+  reset();
+}
+
+void ObAllVirtualCpuProfile::reset()
+{
+  ObVirtualTableScannerIterator::reset();
+  ipstr_.reset();
+  port_ = 0;
+  entry_idx_ = 0;
+}
+
+int ObAllVirtualCpuProfile::inner_open()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(set_ip(addr_))) {
+    LOG_WARN("failed to set server ip addr", K(ret));
+  }
+  return ret;
+}
+
+int ObAllVirtualCpuProfile::set_ip(const common::ObAddr &addr)
+{
+  int ret = OB_SUCCESS;
+  MEMSET(server_ip_, 0, sizeof(server_ip_));
+  if (!addr.is_valid()) {
+    ret = OB_ERR_UNEXPECTED;
+  } else if (!addr.ip_to_string(server_ip_, sizeof(server_ip_))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("ip to string failed", K(ret));
+  } else {
+    ipstr_ = ObString::make_string(server_ip_);
+    port_ = addr.get_port();
+  }
+  return ret;
+}
+
+int ObAllVirtualCpuProfile::inner_get_next_row(common::ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  const ObCpuProfiler &profiler = ObCpuProfiler::get_instance();
+  const ObCpuProfileEntry *entry = NULL;
+  while (NULL == entry && entry_idx_ < ObCpuProfiler::ENTRY_CNT) {
+    entry = profiler.get_entry(entry_idx_++);
+  }
+  if (NULL == entry) {
+    ret = OB_ITER_END;
+  } else if (OB_FAIL(convert_entry_to_row(*entry, row))) {
+    LOG_WARN("fail to convert entry to row", K(ret));
+  }
+  return ret;
+}
+
+int ObAllVirtualCpuProfile::convert_entry_to_row(const ObCpuProfileEntry &entry, ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  ObObj *cells = cur_row_.cells_;
+  if (OB_ISNULL(cells)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("cur row cell is NULL", K(ret));
+  }
+  for (int64_t cell_idx = 0;
+       OB_SUCC(ret) && cell_idx < output_column_ids_.count();
+       ++cell_idx) {
+    const uint64_t column_id = output_column_ids_.at(cell_idx);
+    switch (column_id) {
+      case SVR_IP: {
+        cells[cell_idx].set_varchar(ipstr_);
+        cells[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      }
+      case SVR_PORT: {
+        cells[cell_idx].set_int(port_);
+        break;
+      }
+      case TENANT_ID: {
+        cells[cell_idx].set_int(entry.tenant_id_);
+        break;
+      }
+      case THREAD_NAME: {
+        cells[cell_idx].set_varchar(entry.tname_);
+        cells[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      }
+      case SQL_ID: {
+        cells[cell_idx].set_varchar(entry.sql_id_);
+        cells[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      }
+      case TRACE_ID: {
+        ObCurTraceId::TraceId trace_id;
+        trace_id.set(entry.trace_id_);
+        int64_t len = trace_id.to_string(trace_id_, sizeof(trace_id_));
+        cells[cell_idx].set_varchar(trace_id_, static_cast<ObString::obstr_size_t>(len));
+        cells[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      }
+      case SAMPLE_COUNT: {
+        cells[cell_idx].set_int(ATOMIC_LOAD(&entry.count_));
+        break;
+      }
+      case STACK: {
+        int64_t len = entry.print_folded_stack(stack_, sizeof(stack_));
+        cells[cell_idx].set_varchar(stack_, static_cast<ObString::obstr_size_t>(len));
+        cells[cell_idx].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("invalid column id", K(ret), K(column_id), K(cell_idx), K_(output_column_ids));
+        break;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    row = &cur_row_;
+  }
+  return ret;
+}
+
+} // namespace observer
+} // namespace oceanbase
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_OBSERVER_OB_ALL_VIRTUAL_CPU_PROFILE_H_
+#define OCEANBASE_OBSERVER_OB_ALL_VIRTUAL_CPU_PROFILE_H_
+
+#include "share/ob_virtual_table_scanner_iterator.h"
+#include "lib/net/ob_addr.h"
+#include "lib/profile/ob_cpu_profiler.h"
+
+namespace oceanbase
+{
+namespace observer
+{
+
+// one row per aggregated stack of ObCpuProfiler, stack is folded as root;...;leaf
+class ObAllVirtualCpuProfile : public common::ObVirtualTableScannerIterator
+{
+public:
+  ObAllVirtualCpuProfile();
+  virtual ~ObAllVirtualCpuProfile();
+  virtual int inner_open() override;
+  virtual int inner_get_next_row(common::ObNewRow *&row) override;
+  virtual void reset() override;
+  void set_addr(const common::ObAddr &addr) { addr_ = addr; }
+private:
+  int set_ip(const common::ObAddr &addr);
+  int convert_entry_to_row(const common::ObCpuProfileEntry &entry, common::ObNewRow *&row);
+private:
+  enum COLUMN_ID
+  {
+    SVR_IP = common::OB_APP_MIN_COLUMN_ID,
+    SVR_PORT,
+    TENANT_ID,
+    THREAD_NAME,
+    SQL_ID,
+    TRACE_ID,
+    SAMPLE_COUNT,
+    STACK
+  };
+  static const int64_t STACK_BUF_LEN = 1024;
+  common::ObAddr addr_;
+  common::ObString ipstr_;
+  int32_t port_;
+  int64_t entry_idx_;
+  char server_ip_[common::MAX_IP_ADDR_LENGTH + 2];
+  char trace_id_[common::OB_MAX_TRACE_ID_BUFFER_SIZE];
+  char stack_[STACK_BUF_LEN];
+  DISALLOW_COPY_AND_ASSIGN(ObAllVirtualCpuProfile);
+};
+
+} // namespace observer
+} // namespace oceanbase
+#endif // OCEANBASE_OBSERVER_OB_ALL_VIRTUAL_CPU_PROFILE_H_
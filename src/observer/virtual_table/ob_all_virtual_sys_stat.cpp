@@ -143,6 +143,8 @@ int ObAllVirtualSysStat::update_all_stats_(const int64_t tenant_id, ObStatEventS
         (OB_SYS_TENANT_ID == tenant_id) ? OB_LOGGER.get_dropped_debug_log_count() : 0;
     stat_events.get(ObStatEventIds::ASYNC_LOG_FLUSH_SPEED - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
         (OB_SYS_TENANT_ID == tenant_id) ? OB_LOGGER.get_async_flush_log_speed() : 0;
+    stat_events.get(ObStatEventIds::ASYNC_LOG_DELAYED_COUNT - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
+        (OB_SYS_TENANT_ID == tenant_id) ? OB_LOGGER.get_delayed_log_count() : 0;
 
 
     stat_events.get(ObStatEventIds::ASYNC_GENERIC_LOG_WRITE_COUNT - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
@@ -181,6 +183,8 @@ int ObAllVirtualSysStat::update_all_stats_(const int64_t tenant_id, ObStatEventS
       (OB_SYS_TENANT_ID == tenant_id) ? OB_LOGGER.get_dropped_debug_log_count() : 0;
     stat_events.get(ObStatEventIds::ASYNC_LOG_FLUSH_SPEED - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
       (OB_SYS_TENANT_ID == tenant_id) ? OB_LOGGER.get_async_flush_log_speed() : 0;
+    stat_events.get(ObStatEventIds::ASYNC_LOG_DELAYED_COUNT - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
+      (OB_SYS_TENANT_ID == tenant_id) ? OB_LOGGER.get_delayed_log_count() : 0;
     stat_events.get(ObStatEventIds::MEMORY_HOLD_SIZE - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
         (OB_SYS_TENANT_ID == tenant_id) ? lib::AChunkMgr::instance().get_hold() : 0;
     stat_events.get(ObStatEventIds::MEMORY_USED_SIZE - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
@@ -677,16 +677,6 @@ int ObVirtualSqlPlanMonitor::extract_request_ids(const uint64_t tenant_id,
           break; \
         }
 
-#define CASE_OTHERSTAT_RESERVED(N) \
-        case OTHERSTAT_##N##_ID: { \
-          cells[cell_idx].set_int(0); \
-          break; \
-        } \
-        case OTHERSTAT_##N##_VALUE: { \
-          cells[cell_idx].set_int(0); \
-          break; \
-        }
-
 int ObVirtualSqlPlanMonitor::convert_node_to_row(ObMonitorNode &node, ObNewRow *&row)
 {
   int ret = OB_SUCCESS;
@@ -782,10 +772,10 @@ int ObVirtualSqlPlanMonitor::convert_node_to_row(ObMonitorNode &node, ObNewRow *
       CASE_OTHERSTAT(4);
       CASE_OTHERSTAT(5);
       CASE_OTHERSTAT(6);
-      CASE_OTHERSTAT_RESERVED(7);
-      CASE_OTHERSTAT_RESERVED(8);
-      CASE_OTHERSTAT_RESERVED(9);
-      CASE_OTHERSTAT_RESERVED(10);
+      CASE_OTHERSTAT(7);
+      CASE_OTHERSTAT(8);
+      CASE_OTHERSTAT(9);
+      CASE_OTHERSTAT(10);
       case THREAD_ID: {
         int64_t thread_id = node.get_thread_id();
         cells[cell_idx].set_int(thread_id);
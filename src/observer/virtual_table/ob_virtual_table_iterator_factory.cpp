@@ -176,6 +176,7 @@
 #include "observer/virtual_table/ob_all_virtual_log_stat.h"
 #include "observer/virtual_table/ob_all_virtual_apply_stat.h"
 #include "observer/virtual_table/ob_all_virtual_ha_diagnose.h"
+#include "observer/virtual_table/ob_all_virtual_cpu_profile.h"
 #include "observer/virtual_table/ob_all_virtual_replay_stat.h"
 #include "observer/virtual_table/ob_all_virtual_unit.h"
 #include "observer/virtual_table/ob_all_virtual_server.h"
@@ -1616,6 +1617,15 @@ int ObVTIterCreator::create_vt_iter(ObVTableScanParam &params,
             }
             break;
           }
+          case OB_ALL_VIRTUAL_CPU_PROFILE_TID: {
+            ObAllVirtualCpuProfile *cpu_profile = NULL;
+            if (OB_SUCC(NEW_VIRTUAL_TABLE(ObAllVirtualCpuProfile, cpu_profile))) {
+              cpu_profile->set_allocator(&allocator);
+              cpu_profile->set_addr(addr_);
+              vt_iter = static_cast<ObVirtualTableIterator *>(cpu_profile);
+            }
+            break;
+          }
         END_CREATE_VT_ITER_SWITCH_LAMBDA
 
         BEGIN_CREATE_VT_ITER_SWITCH_LAMBDA
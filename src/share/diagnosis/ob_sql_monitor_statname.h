@@ -52,6 +52,11 @@ SQL_MONITOR_STATNAME_DEF(SORT_DUMP_DATA_TIME, sql_monitor_statname::INT, "sort d
 // SSTABLE INSERT
 SQL_MONITOR_STATNAME_DEF(DDL_TASK_ID, sql_monitor_statname::INT, "ddl task id", "sort ddl task id")
 SQL_MONITOR_STATNAME_DEF(SSTABLE_INSERT_ROW_COUNT, sql_monitor_statname::INT, "sstable insert row count", "sstable insert row count")
+// HARDWARE COUNTERS
+SQL_MONITOR_STATNAME_DEF(HW_CPU_CYCLES, sql_monitor_statname::INT, "cpu cycles", "user space cpu cycles spent in operator itself")
+SQL_MONITOR_STATNAME_DEF(HW_INSTRUCTIONS, sql_monitor_statname::INT, "instructions", "user space instructions retired in operator itself")
+SQL_MONITOR_STATNAME_DEF(HW_LLC_MISSES, sql_monitor_statname::INT, "llc misses", "last level cache misses in operator itself")
+SQL_MONITOR_STATNAME_DEF(HW_BRANCH_MISSES, sql_monitor_statname::INT, "branch misses", "branch mispredictions in operator itself")
 //end
 SQL_MONITOR_STATNAME_DEF(MONITOR_STATNAME_END, sql_monitor_statname::INVALID, "monitor end", "monitor stat name end")
 #endif
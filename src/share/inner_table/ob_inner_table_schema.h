@@ -842,6 +842,7 @@ public:
   static int all_virtual_minor_freeze_info_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_ha_diagnose_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_core_table_schema(share::schema::ObTableSchema &table_schema);
+  static int all_virtual_cpu_profile_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_sql_audit_ora_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_plan_stat_ora_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_plan_cache_plan_explain_ora_schema(share::schema::ObTableSchema &table_schema);
@@ -2767,6 +2768,7 @@ const schema_create_func virtual_table_schema_creators [] = {
   ObInnerTableSchema::all_virtual_minor_freeze_info_schema,
   ObInnerTableSchema::all_virtual_ha_diagnose_schema,
   ObInnerTableSchema::all_virtual_core_table_schema,
+  ObInnerTableSchema::all_virtual_cpu_profile_schema,
   ObInnerTableSchema::all_virtual_sql_audit_ora_schema,
   ObInnerTableSchema::all_virtual_plan_stat_ora_schema,
   ObInnerTableSchema::all_virtual_plan_cache_plan_explain_ora_schema,
@@ -7132,7 +7134,8 @@ const uint64_t cluster_distributed_vtables [] = {
   OB_ALL_VIRTUAL_SCHEMA_MEMORY_TID,
   OB_ALL_VIRTUAL_SCHEMA_SLOT_TID,
   OB_ALL_VIRTUAL_MINOR_FREEZE_INFO_TID,
-  OB_ALL_VIRTUAL_HA_DIAGNOSE_TID,  };
+  OB_ALL_VIRTUAL_HA_DIAGNOSE_TID,
+  OB_ALL_VIRTUAL_CPU_PROFILE_TID,  };
 
 const uint64_t tenant_distributed_vtables [] = {
   OB_ALL_VIRTUAL_PROCESSLIST_TID,
@@ -9257,11 +9260,11 @@ static inline int get_sys_table_lob_aux_schema(const uint64_t tid,
 
 const int64_t OB_CORE_TABLE_COUNT = 4;
 const int64_t OB_SYS_TABLE_COUNT = 215;
-const int64_t OB_VIRTUAL_TABLE_COUNT = 554;
+const int64_t OB_VIRTUAL_TABLE_COUNT = 555;
 const int64_t OB_SYS_VIEW_COUNT = 611;
-const int64_t OB_SYS_TENANT_TABLE_COUNT = 1385;
+const int64_t OB_SYS_TENANT_TABLE_COUNT = 1386;
 const int64_t OB_CORE_SCHEMA_VERSION = 1;
-const int64_t OB_BOOTSTRAP_SCHEMA_VERSION = 1388;
+const int64_t OB_BOOTSTRAP_SCHEMA_VERSION = 1389;
 
 } // end namespace share
 } // end namespace oceanbase
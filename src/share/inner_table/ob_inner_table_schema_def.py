@@ -11018,6 +11018,28 @@ def_table_schema(**gen_iterate_virtual_table_def(
 # 12368: __all_virtual_backup_transferring_tablets
 # 12369: __all_virtual_io_scheduler
 
+def_table_schema(
+  owner = 'agent',
+  table_name = '__all_virtual_cpu_profile',
+  table_id = '12370',
+  table_type = 'VIRTUAL_TABLE',
+  gm_columns = [],
+  in_tenant_space = False,
+  rowkey_columns = [],
+  normal_columns = [
+    ('svr_ip', 'varchar:MAX_IP_ADDR_LENGTH'),
+    ('svr_port', 'int'),
+    ('tenant_id', 'int'),
+    ('thread_name', 'varchar:OB_THREAD_NAME_BUF_LEN'),
+    ('sql_id', 'varchar:OB_MAX_SQL_ID_LENGTH'),
+    ('trace_id', 'varchar:OB_MAX_TRACE_ID_BUFFER_SIZE'),
+    ('sample_count', 'int'),
+    ('stack', 'varchar:1024')
+  ],
+  partition_columns = ['svr_ip', 'svr_port'],
+  vtable_route_policy = 'distributed',
+)
+
 #
 # 余留位置
 #
@@ -17,6 +17,7 @@
 #include "share/io/ob_io_struct.h"
 #include "share/io/ob_io_manager.h"
 #include "lib/time/ob_time_utility.h"
+#include "lib/worker.h"
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -849,29 +850,34 @@ int ObIOHandle::wait(const int64_t timeout_ms)
     int real_wait_timeout = min(OB_IO_MANAGER.get_io_config().data_storage_io_timeout_ms_, timeout_ms);
 
     if (real_wait_timeout > 0) {
-      ObThreadCondGuard guard(req_->cond_);
-      if (OB_FAIL(guard.get_ret())) {
-        LOG_ERROR("fail to guard request condition", K(ret));
-      } else {
-        int64_t wait_ms = real_wait_timeout;
-        int64_t begin_ms = ObTimeUtility::fast_current_time();
-        while (OB_SUCC(ret) && !req_->is_finished_ && wait_ms > 0) {
-          if (OB_FAIL(req_->cond_.wait(wait_ms))) {
-            LOG_WARN("fail to wait request condition", K(ret), K(wait_ms), K(*req_));
-          } else if (!req_->is_finished_) {
-            int64_t duration_ms = ObTimeUtility::fast_current_time() - begin_ms;
-            wait_ms = real_wait_timeout - duration_ms;
+      // notify omt that I'd begin to wait
+      THIS_WORKER.sched_wait();
+      {
+        ObThreadCondGuard guard(req_->cond_);
+        if (OB_FAIL(guard.get_ret())) {
+          LOG_ERROR("fail to guard request condition", K(ret));
+        } else {
+          int64_t wait_ms = real_wait_timeout;
+          int64_t begin_ms = ObTimeUtility::fast_current_time();
+          while (OB_SUCC(ret) && !req_->is_finished_ && wait_ms > 0) {
+            if (OB_FAIL(req_->cond_.wait(wait_ms))) {
+              LOG_WARN("fail to wait request condition", K(ret), K(wait_ms), K(*req_));
+            } else if (!req_->is_finished_) {
+              int64_t duration_ms = ObTimeUtility::fast_current_time() - begin_ms;
+              wait_ms = real_wait_timeout - duration_ms;
+            }
+          }
+          if (OB_UNLIKELY(wait_ms <= 0)) { // rarely happen
+            ret = OB_TIMEOUT;
+            LOG_WARN("fail to wait request condition due to spurious wakeup", 
+                K(ret), K(wait_ms), K(*req_));
+          }
+          if (OB_TIMEOUT == ret) {
+            OB_IO_MANAGER.get_device_health_detector().record_failure(*req_);
           }
-        }
-        if (OB_UNLIKELY(wait_ms <= 0)) { // rarely happen
-          ret = OB_TIMEOUT;
-          LOG_WARN("fail to wait request condition due to spurious wakeup", 
-              K(ret), K(wait_ms), K(*req_));
-        }
-        if (OB_TIMEOUT == ret) {
-          OB_IO_MANAGER.get_device_health_detector().record_failure(*req_);
         }
       }
+      THIS_WORKER.sched_run();
     } else {
       ret = OB_TIMEOUT;
     }
@@ -133,6 +133,11 @@ DEF_TIME(dead_socket_detection_timeout, OB_CLUSTER_PARAMETER, "3s", "[0s,2h]",
 DEF_BOOL(enable_perf_event, OB_CLUSTER_PARAMETER, "True",
          "specifies whether to enable perf event feature. The default value is True.",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_sql_op_hw_counter, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether to collect hardware counters (cpu cycles, instructions, "
+         "llc misses, branch misses) of each operator into sql plan monitor. "
+         "Value: True: turned on; False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(enable_upgrade_mode, OB_CLUSTER_PARAMETER, "False",
          "specifies whether upgrade mode is turned on. "
          "If turned on, daily merger and balancer will be disabled. "
@@ -203,6 +208,11 @@ DEF_BOOL(enable_syslog_recycle, OB_CLUSTER_PARAMETER, "False",
          "specifies whether log file recycling is turned on. "
          "Value: True：turned on; False: turned off",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_syslog_shedding, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether async logs are dropped before waiting once the async log queue "
+         "gets congested, lower level logs and logs of the sql and network modules first. "
+         "Value: True: turned on; False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(memory_limit_percentage, OB_CLUSTER_PARAMETER, "80", "[10, 90]",
         "the size of the memory reserved for internal use(for testing purpose). Range: [10, 90]",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -225,12 +235,24 @@ DEF_STR_WITH_CHECKER(tableapi_transport_compress_func, OB_CLUSTER_PARAMETER, "no
                      common::ObConfigCompressFuncChecker,
                      "compressor used for tableAPI query result. Values: none, lz4_1.0, snappy_1.0, zlib_1.0, zstd_1.0 zstd 1.3.8",
                      ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR_WITH_CHECKER(_ob20_compress_func, OB_CLUSTER_PARAMETER, "none",
+                     common::ObConfigCompressFuncChecker,
+                     "compressor used for ob20 protocol response payload, only takes effect when "
+                     "the client supports it. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
+                     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(_sort_area_size, OB_TENANT_PARAMETER, "128M", "[2M,]",
         "size of maximum memory that could be used by SORT. Range: [2M,+∞)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(_hash_area_size, OB_TENANT_PARAMETER, "100M", "[4M,]",
         "size of maximum memory that could be used by HASH JOIN. Range: [4M,+∞)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_result_cache_max_size, OB_TENANT_PARAMETER, "64M", "[0M,]",
+        "size of maximum memory that could be used by the query result cache, "
+        "0 disables the result cache. Range: [0M,+∞)",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_result_cache_max_result_size, OB_TENANT_PARAMETER, "1M", "[0M,]",
+        "size of maximum result set that could be cached by the query result cache. Range: [0M,+∞)",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 //https://yuque.antfin-inc.com/ob/product_functionality_review/gxmqcg
 DEF_BOOL(_enable_partition_level_retry, OB_CLUSTER_PARAMETER, "True",
@@ -287,6 +309,11 @@ DEF_INT(_ob_max_thread_num, OB_CLUSTER_PARAMETER, "0", "[0,10000)",
          "ob max thread number "
          "upper limit of observer thread count. Range: [0, 10000), 0 means no limit.",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_cpu_profile_frequency, OB_CLUSTER_PARAMETER, "0", "[0,1000]",
+        "samples per second of cpu time taken by the builtin cpu profiler, samples are shown "
+        "in __all_virtual_cpu_profile, changing it restarts the profiling. "
+        "Range: [0, 1000], 0 means disabled",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_DBL(cpu_quota_concurrency, OB_TENANT_PARAMETER, "4", "[1,10]",
         "max allowed concurrency for 1 CPU quota. Range: [1,10]",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -749,6 +776,10 @@ DEF_BOOL(_enable_parallel_minor_merge, OB_TENANT_PARAMETER, "True",
 DEF_BOOL(_enable_adaptive_compaction, OB_TENANT_PARAMETER, "True",
          "specifies whether allow adaptive compaction schedule and information collection",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_stat_collection_in_major_merge, OB_TENANT_PARAMETER, "False",
+         "specifies whether full major merge gathers optimizer statistics of the partitions it rewrites. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(compaction_low_thread_score, OB_TENANT_PARAMETER, "0", "[0,100]",
         "the current work thread score of low priority compaction. Range: [0,100] in integer. Especially, 0 means default value",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -1128,6 +1159,16 @@ DEF_TIME(_xa_gc_interval, OB_CLUSTER_PARAMETER, "1h", "[1s,)",
 DEF_BOOL(_enable_easy_keepalive, OB_CLUSTER_PARAMETER, "True",
          "enable keepalive for each TCP connection.",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_numa_aware, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the worker threads of a tenant are bound to one NUMA node, "
+         "tenants are placed on NUMA nodes in round robin. "
+         "Value: True: bind  False: do not bind",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_blocking_worker_handoff, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether a tenant worker hands its cpu token over to another worker "
+         "while it is blocked on io or rpc. "
+         "Value: True: hand over  False: do not hand over",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(enable_ob_ratelimit, OB_CLUSTER_PARAMETER, "False",
          "enable ratelimit between regions for RPC connection.",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -1200,6 +1241,9 @@ DEF_STR_WITH_CHECKER(_resource_limit_spec, OB_CLUSTER_PARAMETER, "auto", common:
 DEF_BOOL(_enable_px_bloom_filter_sync, OB_TENANT_PARAMETER, "false",
          "specifies whether wait px bloom filter ready with all thread",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_serial_join_filter, OB_TENANT_PARAMETER, "false",
+         "specifies whether to generate join bloom filter for hash join in serial plans",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_STR_WITH_CHECKER(_px_bloom_filter_group_size, OB_TENANT_PARAMETER, "auto", common::ObConfigPxBFGroupSizeChecker,
          "specifies the px bloom filter each group size in sending to the other sqc"
@@ -1236,6 +1280,23 @@ DEF_INT(_session_context_size, OB_CLUSTER_PARAMETER, "10000", "[0, 2147483647]",
 DEF_INT(_px_object_sampling, OB_TENANT_PARAMETER, "200", "[1, 100000]"
         "parallel query sampling for base objects (100000 = 100%)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_px_join_skew_handling, OB_TENANT_PARAMETER, "True",
+         "enables skew handling of popular join key values for parallel hash join. "
+         "Value: True: enabled; False: disabled",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_px_join_skew_minfreq, OB_TENANT_PARAMETER, "30", "[1,100]",
+        "minimum frequency in percentage of rows for a join key value to be handled as popular "
+        "value by parallel hash join. Range: [1,100]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_px_adaptive_dop, OB_TENANT_PARAMETER, "False",
+         "enables adaptive parallelism of leaf scan DFOs: an SQC starts part of its workers "
+         "and adds the rest only when the remaining granules justify it. "
+         "Value: True: enabled; False: disabled",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_px_adaptive_dop_start_pct, OB_TENANT_PARAMETER, "50", "[1,100]",
+        "percentage of the reserved workers an SQC starts with when adaptive parallelism is "
+        "enabled. Range: [1,100]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_TIME(_follower_snapshot_read_retry_duration, OB_TENANT_PARAMETER, "0ms", "[0ms,]",
          "the waiting time after the first judgment failure of strong reading on follower"
          "Range: [0ms, +∞)",
@@ -2726,6 +2726,8 @@ int ObStaticEngineCG::generate_spec(ObLogExchange &op, ObPxDistTransmitSpec &spe
     LOG_WARN("fail generate hash func exprs", K(ret));
   } else if (op.is_pq_range() && OB_FAIL(generate_range_dist_spec(op, spec))) {
     LOG_WARN("fail to generate range dist", K(ret));
+  } else if (op.is_pq_hybrid_hash() && OB_FAIL(generate_popular_values_hash(op, spec))) {
+    LOG_WARN("fail to generate popular values hash", K(ret));
   } else if (ObPQDistributeMethod::PARTITION_HASH == op.get_dist_method()
             || ObPQDistributeMethod::SM_BROADCAST == op.get_dist_method()) {
     if (OB_ISNULL(op.get_calc_part_id_expr())) {
@@ -2777,6 +2779,37 @@ int ObStaticEngineCG::generate_hash_func_exprs(
   return ret;
 }
 
+// Popular values are hashed with the hash function of the distribution expr here,
+// the hybrid hash transmit compares them with the hash value of each row.
+int ObStaticEngineCG::generate_popular_values_hash(
+    ObLogExchange &op,
+    ObPxDistTransmitSpec &spec)
+{
+  int ret = OB_SUCCESS;
+  const ObIArray<ObObj> &popular_values = op.get_popular_values();
+  if (OB_UNLIKELY(1 != spec.dist_exprs_.count() || 1 != spec.dist_hash_funcs_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("hybrid hash distribution only support single key", K(ret),
+             K(spec.dist_exprs_.count()));
+  } else if (OB_FAIL(spec.popular_hash_vals_.init(popular_values.count()))) {
+    LOG_WARN("failed to init popular hash values", K(ret));
+  } else {
+    char buf[OBJ_DATUM_NUMBER_RES_SIZE];
+    ObDatum datum;
+    for (int64_t i = 0; OB_SUCC(ret) && i < popular_values.count(); ++i) {
+      datum.ptr_ = buf;
+      if (OB_FAIL(datum.from_obj(popular_values.at(i), spec.dist_exprs_.at(0)->obj_datum_map_))) {
+        LOG_WARN("failed to convert obj to datum", K(ret), K(popular_values.at(i)));
+      } else if (OB_FAIL(spec.popular_hash_vals_.push_back(
+                 spec.dist_hash_funcs_.at(0).hash_func_(datum,
+                                                        ObSliceIdxCalc::SLICE_CALC_HASH_SEED)))) {
+        LOG_WARN("failed to push back popular hash value", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObStaticEngineCG::generate_range_dist_spec(
     ObLogExchange &op,
     ObPxDistTransmitSpec &spec)
@@ -6243,12 +6276,145 @@ int ObStaticEngineCG::set_other_properties(const ObLogPlan &log_plan, ObPhysical
       phy_plan_->set_has_nested_sql(true);
     } else {/*do nothing*/}
   }
+  if (OB_SUCC(ret) && log_plan.get_optimizer_context().get_global_hint().enable_result_cache()) {
+    bool enable_result_cache = false;
+    if (OB_FAIL(check_enable_result_cache(log_plan, phy_plan, enable_result_cache))) {
+      LOG_WARN("failed to check enable result cache", K(ret));
+    } else {
+      phy_plan.set_enable_result_cache(enable_result_cache);
+    }
+  }
   if (OB_SUCC(ret)) {
     phy_plan_->calc_whether_need_trans();
   }
   return ret;
 }
 
+// the cached result is reused by later executions with the same parameters,
+// so only a local strong consistency select whose result depends on nothing
+// but the latest table data and the parameters could be cached.
+int ObStaticEngineCG::check_enable_result_cache(const ObLogPlan &log_plan,
+                                                const ObPhysicalPlan &phy_plan,
+                                                bool &enable)
+{
+  int ret = OB_SUCCESS;
+  const ObDMLStmt *stmt = log_plan.get_stmt();
+  const ObQueryCtx *query_ctx = NULL;
+  const ObConsistencyLevel read_consistency =
+      log_plan.get_optimizer_context().get_global_hint().read_consistency_;
+  bool has_fq = false;
+  enable = false;
+  if (OB_ISNULL(stmt) || OB_ISNULL(query_ctx = stmt->get_query_ctx())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), K(stmt));
+  } else if (OB_FAIL(check_has_flashback_query(log_plan.get_plan_root(), has_fq))) {
+    LOG_WARN("failed to check flashback query", K(ret));
+  } else if (!stmt->is_select_stmt()
+             || has_fq
+             || (INVALID_CONSISTENCY != read_consistency && STRONG != read_consistency)
+             || stmt->has_for_update()
+             || !phy_plan.is_local_plan()
+             || !phy_plan.contain_table_scan()
+             || query_ctx->is_contain_virtual_table_
+             || query_ctx->is_contain_inner_table_
+             || query_ctx->has_udf_
+             || query_ctx->has_pl_udf_
+             || query_ctx->has_dml_write_stmt_
+             || phy_plan.has_link_table()
+             || phy_plan.is_contain_oracle_trx_level_temporary_table()
+             || phy_plan.is_contain_oracle_session_level_temporary_table()) {
+    // do nothing
+  } else {
+    const ObIArray<ObRawExpr *> &exprs = log_plan.get_optimizer_context().get_all_exprs().get_expr_array();
+    enable = true;
+    bool has_session_expr = false;
+    for (int64_t i = 0; OB_SUCC(ret) && enable && i < exprs.count(); ++i) {
+      const ObRawExpr *expr = exprs.at(i);
+      if (OB_ISNULL(expr)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("get unexpected null", K(ret));
+      } else if (OB_FAIL(check_has_session_dependent_expr(expr, has_session_expr))) {
+        LOG_WARN("failed to check session dependent expr", K(ret));
+      } else if (has_session_expr
+                 || expr->has_flag(CNT_STATE_FUNC)
+                 || expr->has_flag(CNT_RAND_FUNC)
+                 || expr->has_flag(CNT_CUR_TIME)
+                 || expr->has_flag(CNT_USER_VARIABLE)
+                 || expr->has_flag(CNT_SEQ_EXPR)
+                 || expr->has_flag(CNT_SO_UDF)
+                 || expr->has_flag(CNT_PL_UDF)
+                 || expr->has_flag(CNT_VOLATILE_CONST)
+                 || expr->has_flag(CNT_LAST_INSERT_ID)
+                 || expr->has_flag(CNT_ORA_ROWSCN_EXPR)) {
+        enable = false;
+      }
+    }
+    // the pre-calculated exprs are replaced by parameters in the plan
+    for (int64_t i = 0; OB_SUCC(ret) && enable && i < query_ctx->calculable_items_.count(); ++i) {
+      if (OB_FAIL(check_has_session_dependent_expr(query_ctx->calculable_items_.at(i).expr_,
+                                                   has_session_expr))) {
+        LOG_WARN("failed to check session dependent expr", K(ret));
+      } else if (has_session_expr) {
+        enable = false;
+      }
+    }
+  }
+  LOG_TRACE("check enable result cache", K(enable));
+  return ret;
+}
+
+int ObStaticEngineCG::check_has_flashback_query(const ObLogicalOperator *op, bool &has_fq)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(op)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (log_op_def::LOG_TABLE_SCAN == op->get_type()
+             && NULL != static_cast<const ObLogTableScan *>(op)->get_flashback_query_expr()) {
+    has_fq = true;
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && !has_fq && i < op->get_num_of_child(); ++i) {
+      if (OB_FAIL(SMART_CALL(check_has_flashback_query(op->get_child(i), has_fq)))) {
+        LOG_WARN("failed to check flashback query", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+// Exprs whose result depends on the session or on the previous statement
+// rather than on the parameters and the table data.
+int ObStaticEngineCG::check_has_session_dependent_expr(const ObRawExpr *expr,
+                                                       bool &has_session_expr)
+{
+  int ret = OB_SUCCESS;
+  bool is_non_pure = false;
+  has_session_expr = false;
+  if (OB_ISNULL(expr)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else if (OB_FAIL(expr->is_non_pure_sys_func_expr(is_non_pure))) {
+    LOG_WARN("failed to check non pure sys func expr", K(ret));
+  } else if (is_non_pure
+             || T_OP_GET_SYS_VAR == expr->get_expr_type()
+             || T_FUN_SYS_SYS_CONTEXT == expr->get_expr_type()
+             || T_FUN_SYS_CONNECTION_ID == expr->get_expr_type()
+             || T_FUN_SYS_USER == expr->get_expr_type()
+             || T_FUN_SYS_CURRENT_USER == expr->get_expr_type()
+             || T_FUN_SYS_FOUND_ROWS == expr->get_expr_type()
+             || T_FUN_SYS_ROW_COUNT == expr->get_expr_type()) {
+    has_session_expr = true;
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && !has_session_expr && i < expr->get_param_count(); ++i) {
+      if (OB_FAIL(SMART_CALL(check_has_session_dependent_expr(expr->get_param_expr(i),
+                                                              has_session_expr)))) {
+        LOG_WARN("failed to check session dependent expr", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 // FIXME bin.lb: We should split the big switch case into logical operator class.
 int ObStaticEngineCG::get_phy_op_type(ObLogicalOperator &log_op,
                                          ObPhyOperatorType &type,
@@ -173,6 +173,11 @@ private:
                                           common::ObIArray<ObRawExpr*> &anti_monotone_filters);
 
   int set_other_properties(const ObLogPlan &log_plan, ObPhysicalPlan &phy_plan);
+  int check_enable_result_cache(const ObLogPlan &log_plan,
+                                const ObPhysicalPlan &phy_plan,
+                                bool &enable);
+  int check_has_flashback_query(const ObLogicalOperator *op, bool &has_fq);
+  int check_has_session_dependent_expr(const ObRawExpr *expr, bool &has_session_expr);
 
   // Post order visit logic plan and generate operator specification.
   // %in_root_job indicate that the operator is executed in main execution thread,
@@ -431,6 +436,9 @@ private:
   int generate_range_dist_spec(ObLogExchange &op,
       ObPxDistTransmitSpec &spec);
 
+  int generate_popular_values_hash(ObLogExchange &op,
+      ObPxDistTransmitSpec &spec);
+
   int filter_sort_keys(
       ObLogExchange &op,
       const ObIArray<OrderItem> &old_sort_keys,
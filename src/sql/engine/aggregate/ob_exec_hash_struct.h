@@ -21,6 +21,9 @@
 #include "lib/container/ob_2d_array.h"
 #include "sql/engine/basic/ob_chunk_datum_store.h"
 #include "sql/engine/ob_sql_mem_mgr_processor.h"
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 
 namespace oceanbase
 {
@@ -310,6 +313,305 @@ int ObExtendHashTable<Item>::extend()
 }
 
 
+// Open addressing hash table of swiss table layout, for keys composed of no more than
+// KEY_CNT fixed width (at most 8 bytes) columns.
+//
+// Every slot has a control byte, which is EMPTY or the low 7 bits of the hash value.
+// Control bytes are probed GROUP_SIZE at a time with SSE2, and the key is stored inline
+// in the slot, so a probe visits neither the item nor the stored row.
+// Items with the same key are not linked, the caller should make sure the key is not
+// exist before set.
+template <typename Item, int64_t KEY_CNT>
+class ObInlineKeyHashTable
+{
+public:
+  const static int64_t INITIAL_SIZE = 128;
+  const static int64_t SIZE_BUCKET_SCALE = 2;
+  const static int64_t GROUP_SIZE = 16;
+  const static uint8_t EMPTY = 0x80;
+  const static uint64_t H2_MASK = 0x7F;
+  const static int64_t H2_BITS = 7;
+
+  struct Key
+  {
+    uint64_t values_[KEY_CNT > 0 ? KEY_CNT : 1]; // zero for null column
+    uint64_t null_bits_;
+    OB_INLINE bool operator==(const Key &other) const
+    {
+      bool equal = null_bits_ == other.null_bits_;
+      for (int64_t i = 0; equal && i < KEY_CNT; i++) {
+        equal = values_[i] == other.values_[i];
+      }
+      return equal;
+    }
+    TO_STRING_KV(K_(null_bits));
+  };
+  struct Slot
+  {
+    uint64_t hash_;
+    Item *item_;
+    Key key_;
+  };
+
+  ObInlineKeyHashTable()
+    : initial_bucket_num_(0),
+      size_(0),
+      bucket_num_(0),
+      group_mask_(0),
+      buf_(NULL),
+      ctrls_(NULL),
+      slots_(NULL),
+      allocator_("InlineKeyHT")
+  {
+  }
+  ~ObInlineKeyHashTable() { destroy(); }
+
+  int init(ObIAllocator *allocator, lib::ObMemAttr &mem_attr,
+           int64_t initial_size = INITIAL_SIZE);
+  bool is_inited() const { return NULL != buf_; }
+  // return the item with the same key, NULL for none exist.
+  OB_INLINE const Item *get(const uint64_t hash_val, const Key &key) const
+  {
+    const Item *res = NULL;
+    if (OB_LIKELY(NULL != buf_)) {
+      bool found = false;
+      const int64_t pos = locate(hash_val, key, found);
+      res = found ? slots_[pos].item_ : NULL;
+    }
+    return res;
+  }
+  // Put item to hash table, extend buckets if needed.
+  // (Do not check item is exist or not)
+  int set(const uint64_t hash_val, const Key &key, Item &item);
+  OB_INLINE void prefetch(const uint64_t hash_val) const
+  {
+    const int64_t pos = ((hash_val >> H2_BITS) & group_mask_) * GROUP_SIZE;
+    __builtin_prefetch(ctrls_ + pos, 0/* read */, 2 /*high temp locality*/);
+    __builtin_prefetch(slots_ + pos, 0/* read */, 2 /*high temp locality*/);
+  }
+  int64_t size() const { return size_; }
+
+  void reuse()
+  {
+    if (NULL != ctrls_) {
+      MEMSET(ctrls_, EMPTY, bucket_num_);
+    }
+    size_ = 0;
+  }
+
+  int resize(ObIAllocator *allocator, int64_t bucket_num);
+
+  void destroy()
+  {
+    if (NULL != buf_) {
+      allocator_.free(buf_);
+      buf_ = NULL;
+    }
+    ctrls_ = NULL;
+    slots_ = NULL;
+    allocator_.set_allocator(nullptr);
+    size_ = 0;
+    bucket_num_ = 0;
+    group_mask_ = 0;
+    initial_bucket_num_ = 0;
+  }
+  int64_t mem_used() const
+  {
+    return NULL == buf_ ? 0 : alloc_size(bucket_num_);
+  }
+
+  inline int64_t get_bucket_num() const { return bucket_num_; }
+  template <typename CB>
+  int foreach(CB &cb) const
+  {
+    int ret = common::OB_SUCCESS;
+    if (OB_ISNULL(buf_)) {
+      ret = OB_INVALID_ARGUMENT;
+      SQL_ENG_LOG(WARN, "invalid null buckets", K(ret), KP(buf_));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < bucket_num_; i++) {
+      if (EMPTY != ctrls_[i] && OB_FAIL(cb(*slots_[i].item_))) {
+        SQL_ENG_LOG(WARN, "call back failed", K(ret));
+      }
+    }
+    return ret;
+  }
+private:
+  static int64_t alloc_size(const int64_t bucket_num)
+  {
+    return bucket_num + GROUP_SIZE + bucket_num * static_cast<int64_t>(sizeof(Slot));
+  }
+  // bit i is set if the i-th control byte of the group equals to %ctrl
+  OB_INLINE static uint32_t match_group(const uint8_t *group, const uint8_t ctrl)
+  {
+#if defined(__x86_64__)
+    const __m128i ctrls = _mm_load_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrls, _mm_set1_epi8(static_cast<char>(ctrl)))));
+#else
+    uint32_t mask = 0;
+    for (int64_t i = 0; i < GROUP_SIZE; i++) {
+      mask |= static_cast<uint32_t>(group[i] == ctrl) << i;
+    }
+    return mask;
+#endif
+  }
+  // Locate the slot with the same key, or the empty slot to insert %key if not found.
+  // Slots are never removed, so the first empty slot of the probe sequence ends the probe.
+  OB_INLINE int64_t locate(const uint64_t hash_val, const Key &key, bool &found) const
+  {
+    const uint8_t h2 = static_cast<uint8_t>(hash_val & H2_MASK);
+    int64_t group = (hash_val >> H2_BITS) & group_mask_;
+    int64_t pos = -1;
+    found = false;
+    // The extend logical make sure the table never full, so an empty slot always exist
+    while (pos < 0) {
+      const uint8_t *ctrl = ctrls_ + group * GROUP_SIZE;
+      for (uint32_t match = match_group(ctrl, h2); !found && 0 != match; match &= match - 1) {
+        const int64_t idx = group * GROUP_SIZE + __builtin_ctz(match);
+        if (slots_[idx].hash_ == hash_val && slots_[idx].key_ == key) {
+          found = true;
+          pos = idx;
+        }
+      }
+      if (!found) {
+        const uint32_t empty = match_group(ctrl, EMPTY);
+        if (0 != empty) {
+          pos = group * GROUP_SIZE + __builtin_ctz(empty);
+        } else {
+          group = (group + 1) & group_mask_;
+        }
+      }
+    }
+    return pos;
+  }
+  int extend();
+  DISALLOW_COPY_AND_ASSIGN(ObInlineKeyHashTable);
+private:
+  lib::ObMemAttr mem_attr_;
+  int64_t initial_bucket_num_;
+  int64_t size_;
+  int64_t bucket_num_;
+  int64_t group_mask_;
+  void *buf_;
+  uint8_t *ctrls_; // GROUP_SIZE aligned
+  Slot *slots_;
+  common::ModulePageAllocator allocator_;
+};
+
+template <typename Item, int64_t KEY_CNT>
+int ObInlineKeyHashTable<Item, KEY_CNT>::init(
+  ObIAllocator *allocator,
+  lib::ObMemAttr &mem_attr,
+  const int64_t initial_size /* INITIAL_SIZE */)
+{
+  int ret = common::OB_SUCCESS;
+  if (initial_size < 2) {
+    ret = common::OB_INVALID_ARGUMENT;
+    SQL_ENG_LOG(WARN, "invalid argument", K(ret));
+  } else {
+    mem_attr_ = mem_attr;
+    allocator_.set_allocator(allocator);
+    allocator_.set_label(mem_attr.label_);
+    initial_bucket_num_ = std::max(GROUP_SIZE,
+        static_cast<int64_t>(common::next_pow2(initial_size * SIZE_BUCKET_SCALE)));
+    size_ = 0;
+    if (OB_FAIL(extend())) {
+      SQL_ENG_LOG(WARN, "extend failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+template <typename Item, int64_t KEY_CNT>
+int ObInlineKeyHashTable<Item, KEY_CNT>::resize(ObIAllocator *allocator, int64_t bucket_num)
+{
+  int ret = OB_SUCCESS;
+  if (bucket_num < get_bucket_num() / 2) {
+    destroy();
+    if (OB_FAIL(init(allocator, mem_attr_, bucket_num))) {
+      SQL_ENG_LOG(WARN, "failed to reuse with bucket", K(bucket_num), K(ret));
+    }
+  } else {
+    reuse();
+  }
+  return ret;
+}
+
+template <typename Item, int64_t KEY_CNT>
+int ObInlineKeyHashTable<Item, KEY_CNT>::set(const uint64_t hash_val, const Key &key, Item &item)
+{
+  int ret = common::OB_SUCCESS;
+  // extend if 7/8 filled, control bytes probing keeps short probe sequence at high load
+  if ((size_ + 1) * 8 > bucket_num_ * 7) {
+    if (OB_FAIL(extend())) {
+      SQL_ENG_LOG(WARN, "extend failed", K(ret));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    // do nothing
+  } else if (OB_ISNULL(buf_)) {
+    ret = OB_INVALID_ARGUMENT;
+    SQL_ENG_LOG(WARN, "invalid argument", K(ret), KP(buf_));
+  } else {
+    bool found = false;
+    const int64_t pos = locate(hash_val, key, found);
+    if (OB_UNLIKELY(found)) {
+      ret = OB_ERR_UNEXPECTED;
+      SQL_ENG_LOG(WARN, "key already exist", K(ret), K(hash_val), K(key));
+    } else {
+      ctrls_[pos] = static_cast<uint8_t>(hash_val & H2_MASK);
+      slots_[pos].hash_ = hash_val;
+      slots_[pos].item_ = &item;
+      slots_[pos].key_ = key;
+      size_ += 1;
+    }
+  }
+  return ret;
+}
+
+template <typename Item, int64_t KEY_CNT>
+int ObInlineKeyHashTable<Item, KEY_CNT>::extend()
+{
+  int ret = common::OB_SUCCESS;
+  const int64_t pre_bucket_num = bucket_num_;
+  const int64_t new_bucket_num = 0 == pre_bucket_num ?
+                                 (0 == initial_bucket_num_ ? INITIAL_SIZE : initial_bucket_num_)
+                                 : pre_bucket_num * 2;
+  SQL_ENG_LOG(DEBUG, "extend inline key hash table", K(ret), K(new_bucket_num),
+              K(initial_bucket_num_), K(pre_bucket_num));
+  void *new_buf = NULL;
+  if (new_bucket_num <= pre_bucket_num) {
+  } else if (OB_ISNULL(new_buf = allocator_.alloc(alloc_size(new_bucket_num), mem_attr_))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SQL_ENG_LOG(WARN, "failed to allocate memory", K(ret), K(new_bucket_num));
+  } else {
+    void *pre_buf = buf_;
+    uint8_t *pre_ctrls = ctrls_;
+    Slot *pre_slots = slots_;
+    buf_ = new_buf;
+    ctrls_ = reinterpret_cast<uint8_t *>(
+        (reinterpret_cast<uint64_t>(new_buf) + GROUP_SIZE - 1) & ~(GROUP_SIZE - 1));
+    slots_ = reinterpret_cast<Slot *>(ctrls_ + new_bucket_num);
+    bucket_num_ = new_bucket_num;
+    group_mask_ = new_bucket_num / GROUP_SIZE - 1;
+    MEMSET(ctrls_, EMPTY, new_bucket_num);
+    for (int64_t i = 0; i < pre_bucket_num; i++) {
+      if (EMPTY != pre_ctrls[i]) {
+        bool found = false;
+        const int64_t pos = locate(pre_slots[i].hash_, pre_slots[i].key_, found);
+        ctrls_[pos] = pre_ctrls[i];
+        slots_[pos] = pre_slots[i];
+      }
+    }
+    if (NULL != pre_buf) {
+      allocator_.free(pre_buf);
+    }
+  }
+  return ret;
+}
+
+
 //Used for calc hash for columns
 class ObHashCols
 {
@@ -66,13 +66,23 @@ int ObGroupRowHashTable::init(ObIAllocator *allocator,
                               const ObIArray<ObExpr *> &gby_exprs,
                               ObEvalCtx *eval_ctx,
                               const common::ObIArray<ObCmpFunc> *cmp_funcs,
-                              int64_t initial_size)
+                              int64_t initial_size,
+                              const bool enable_inline_key)
 {
   int ret = OB_SUCCESS;
-  if (OB_FAIL(ObExtendHashTable<ObGroupRowItem>::init(
+  use_inline_key_ = enable_inline_key && gby_exprs.count() <= MAX_INLINE_KEY_CNT;
+  for (int64_t i = 0; use_inline_key_ && i < gby_exprs.count(); i++) {
+    use_inline_key_ = (nullptr == gby_exprs.at(i) || is_inline_key_type(*gby_exprs.at(i)));
+  }
+  if (use_inline_key_) {
+    if (OB_FAIL(inline_rows_.init(allocator, mem_attr, initial_size))) {
+      LOG_WARN("failed to init inline key hash table", K(ret));
+    }
+  } else if (OB_FAIL(ObExtendHashTable<ObGroupRowItem>::init(
               allocator, mem_attr, initial_size))) {
     LOG_WARN("failed to init extended hash table", K(ret));
-  } else {
+  }
+  if (OB_SUCC(ret)) {
     gby_exprs_ = &gby_exprs;
     eval_ctx_ = eval_ctx;
     cmp_funcs_ = cmp_funcs;
@@ -80,6 +90,46 @@ int ObGroupRowHashTable::init(ObIAllocator *allocator,
   return ret;
 }
 
+// Types whose datums are equal if and only if the bytes are equal, and no more than 8 bytes.
+bool ObGroupRowHashTable::is_inline_key_type(const ObExpr &expr)
+{
+  bool is_inline = false;
+  switch (ob_obj_type_class(expr.datum_meta_.type_)) {
+    case ObIntTC:
+    case ObUIntTC:
+    case ObDateTimeTC:
+    case ObDateTC:
+    case ObTimeTC:
+    case ObYearTC:
+    case ObBitTC: {
+      is_inline = true;
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+  return is_inline;
+}
+
+int ObGroupRowHashTable::set(ObGroupRowItem &item)
+{
+  int ret = OB_SUCCESS;
+  if (!use_inline_key_) {
+    ret = ObExtendHashTable<ObGroupRowItem>::set(item);
+  } else if (OB_UNLIKELY(!item.is_expr_row_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("group by data of inline key hash table must be on expr", K(ret), K(item));
+  } else {
+    InlineKeyHashTable::Key key;
+    build_inline_key(item.batch_idx_, key);
+    if (OB_FAIL(inline_rows_.set(item.hash(), key, item))) {
+      LOG_WARN("failed to set inline key hash table", K(ret));
+    }
+  }
+  return ret;
+}
+
 bool ObGroupRowHashTable::likely_equal(
   const ObGroupRowItem &left, const ObGroupRowItem &right) const
 {
@@ -207,7 +257,9 @@ int ObHashGroupByOp::inner_open()
                 dup_groupby_exprs_,
                 &eval_ctx_,
                 &MY_SPEC.cmp_funcs_,
-                init_size))) {
+                init_size,
+                is_vectorized()
+                && ObThreeStageAggrStage::NONE_STAGE == MY_SPEC.aggr_stage_))) {
       LOG_WARN("fail to init hash map", K(ret));
     } else if (OB_FAIL(sql_mem_processor_.update_used_mem_size(get_mem_used_size()))) {
       LOG_WARN("fail to update_used_mem_size", "size", get_mem_used_size(), K(ret));
@@ -114,29 +114,105 @@ public:
 class ObGroupRowHashTable : public ObExtendHashTable<ObGroupRowItem>
 {
 public:
-  ObGroupRowHashTable() : ObExtendHashTable(), eval_ctx_(nullptr), cmp_funcs_(nullptr) {}
+  // group by columns stored inline in the hash table
+  const static int64_t MAX_INLINE_KEY_CNT = 2;
+  typedef ObInlineKeyHashTable<ObGroupRowItem, MAX_INLINE_KEY_CNT> InlineKeyHashTable;
+
+  ObGroupRowHashTable()
+    : ObExtendHashTable(), eval_ctx_(nullptr), cmp_funcs_(nullptr), use_inline_key_(false)
+  {}
 
   OB_INLINE const ObGroupRowItem *get(const ObGroupRowItem &item) const;
   OB_INLINE void prefetch(const ObBatchRows &brs, uint64_t *hash_vals) const;
+  // Keys are stored inline if %enable_inline_key is set and group by columns are
+  // fixed width, group by data must be on expr (ObGroupRowItem::is_expr_row_) when
+  // get and set in this case.
   int init(ObIAllocator *allocator,
           lib::ObMemAttr &mem_attr,
           const common::ObIArray<ObExpr *> &gby_exprs,
           ObEvalCtx *eval_ctx,
           const common::ObIArray<ObCmpFunc> *cmp_funcs,
-          int64_t initial_size = INITIAL_SIZE);
+          int64_t initial_size = INITIAL_SIZE,
+          const bool enable_inline_key = false);
+  int set(ObGroupRowItem &item);
+  bool is_inited() const
+  {
+    return use_inline_key_ ? inline_rows_.is_inited() : ObExtendHashTable::is_inited();
+  }
+  int64_t size() const { return use_inline_key_ ? inline_rows_.size() : size_; }
+  void reuse()
+  {
+    if (use_inline_key_) {
+      inline_rows_.reuse();
+    } else {
+      ObExtendHashTable::reuse();
+    }
+  }
+  int resize(ObIAllocator *allocator, int64_t bucket_num)
+  {
+    return use_inline_key_
+        ? inline_rows_.resize(allocator, bucket_num)
+        : ObExtendHashTable::resize(allocator, bucket_num);
+  }
+  void destroy()
+  {
+    inline_rows_.destroy();
+    ObExtendHashTable::destroy();
+    use_inline_key_ = false;
+  }
+  int64_t mem_used() const
+  {
+    return use_inline_key_ ? inline_rows_.mem_used() : ObExtendHashTable::mem_used();
+  }
+  int64_t get_bucket_num() const
+  {
+    return use_inline_key_ ? inline_rows_.get_bucket_num() : ObExtendHashTable::get_bucket_num();
+  }
+  template <typename CB>
+  int foreach(CB &cb) const
+  {
+    return use_inline_key_ ? inline_rows_.foreach(cb) : ObExtendHashTable::foreach(cb);
+  }
+  static bool is_inline_key_type(const ObExpr &expr);
 private:
   bool likely_equal(const ObGroupRowItem &left, const ObGroupRowItem &right) const;
+  OB_INLINE void build_inline_key(const int64_t batch_idx,
+                                  InlineKeyHashTable::Key &key) const;
 private:
   const common::ObIArray<ObExpr *> *gby_exprs_;
   ObEvalCtx *eval_ctx_;
   const common::ObIArray<ObCmpFunc> *cmp_funcs_;
+  bool use_inline_key_;
+  InlineKeyHashTable inline_rows_;
   static const int64_t HASH_BUCKET_PREFETCH_MAGIC_NUM = 4 * 1024;
 };
 
+OB_INLINE void ObGroupRowHashTable::build_inline_key(const int64_t batch_idx,
+                                                     InlineKeyHashTable::Key &key) const
+{
+  MEMSET(&key, 0, sizeof(key));
+  const int64_t group_col_count = gby_exprs_->count();
+  for (int64_t i = 0; i < group_col_count; ++i) {
+    const ObExpr *e = gby_exprs_->at(i);
+    const ObDatum *datum = nullptr == e ? nullptr : &e->locate_expr_datum(*eval_ctx_, batch_idx);
+    if (nullptr == datum || datum->is_null()) {
+      key.null_bits_ |= (1UL << i);
+    } else {
+      // datum length of inline key type never exceeds 8 bytes
+      MEMCPY(&key.values_[i], datum->ptr_, std::min(static_cast<int64_t>(datum->len_),
+                                                    static_cast<int64_t>(sizeof(uint64_t))));
+    }
+  }
+}
+
 OB_INLINE const ObGroupRowItem *ObGroupRowHashTable::get(const ObGroupRowItem &item) const
 {
   ObGroupRowItem *res = NULL;
-  if (OB_UNLIKELY(NULL == buckets_)) {
+  if (use_inline_key_) {
+    InlineKeyHashTable::Key key;
+    build_inline_key(item.batch_idx_, key);
+    res = const_cast<ObGroupRowItem *>(inline_rows_.get(item.hash(), key));
+  } else if (OB_UNLIKELY(NULL == buckets_)) {
     // do nothing
   } else {
     const uint64_t hash_val = item.hash();
@@ -154,7 +230,17 @@ OB_INLINE const ObGroupRowItem *ObGroupRowHashTable::get(const ObGroupRowItem &i
 
 OB_INLINE void ObGroupRowHashTable::prefetch(const ObBatchRows &brs, uint64_t *hash_vals) const
 {
-  if (OB_UNLIKELY(NULL == buckets_)) {
+  if (use_inline_key_) {
+    // keys are inline, only the control bytes and slots need to be prefetched
+    if (inline_rows_.get_bucket_num() > HASH_BUCKET_PREFETCH_MAGIC_NUM) {
+      for(auto i = 0; i < brs.size_; i++) {
+        if (brs.skip_->at(i)) {
+          continue;
+        }
+        inline_rows_.prefetch(hash_vals[i]);
+      }
+    }
+  } else if (OB_UNLIKELY(NULL == buckets_)) {
     // do nothing
   } else if (buckets_->count() <= HASH_BUCKET_PREFETCH_MAGIC_NUM) {
     // stop prefetching if hashtable is not big enough
@@ -16,6 +16,7 @@
 #include "sql/engine/ob_exec_context.h"
 #include "sql/resolver/expr/ob_raw_expr_util.h"
 #include "sql/code_generator/ob_static_engine_cg.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 #include "storage/blocksstable/ob_datum_row.h"
 
@@ -295,6 +296,8 @@ int ObPushdownFilterConstructor::merge_filter_node(
   if (OB_ISNULL(other) || OB_ISNULL(dst) || dst == other) {
   } else if (dst->get_type() == other->get_type()) {
     if (dst->get_type() == PushdownFilterType::BLACK_FILTER
+        && !static_cast<ObPushdownBlackFilterNode *>(dst)->is_runtime_filter()
+        && !static_cast<ObPushdownBlackFilterNode *>(other)->is_runtime_filter()
         && is_array_equal(dst->get_col_ids(), other->get_col_ids()))
     {
       if (OB_FAIL(merged_node.push_back(other))) {
@@ -1251,6 +1254,22 @@ int ObBlackFilterExecutor::eval_exprs_batch(ObBitVector &skip, const int64_t bsi
   return ret;
 }
 
+int ObBlackFilterExecutor::check_runtime_filter_pass_all(const int64_t row_count, bool &pass_all)
+{
+  int ret = OB_SUCCESS;
+  pass_all = false;
+  if (OB_UNLIKELY(!is_runtime_filter())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected filter, not runtime filter", K(ret), K_(filter));
+  } else if (OB_FAIL(ObExprJoinFilter::check_pass_all(*filter_.filter_exprs_.at(0),
+                                                      op_.get_eval_ctx(),
+                                                      row_count,
+                                                      pass_all))) {
+    LOG_WARN("Failed to check join filter", K(ret));
+  }
+  return ret;
+}
+
 int ObBlackFilterExecutor::filter_batch(
     ObPushdownFilterExecutor *parent,
     const int64_t start,
@@ -151,6 +151,13 @@ public:
 
   int merge(common::ObIArray<ObPushdownFilterNode*> &merged_node) override;
   virtual int postprocess() override;
+  // join bloom filter is kept as a separate node and never merged with other filters,
+  // so that storage can skip it as a whole when it can not filter any row
+  OB_INLINE bool is_runtime_filter() const
+  {
+    const ObExpr *expr = filter_exprs_.count() > 0 ? filter_exprs_.at(0) : tmp_expr_;
+    return filter_exprs_.count() <= 1 && nullptr != expr && T_OP_JOIN_BLOOM_FILTER == expr->type_;
+  }
   INHERIT_TO_STRING_KV("ObPushdownBlackFilterNode", ObPushdownFilterNode,
                        K_(column_exprs), K_(filter_exprs));
 public:
@@ -404,6 +411,9 @@ public:
   int filter(blocksstable::ObStorageDatum *datums, int64_t col_cnt, bool &ret_val);
   virtual int init_evaluated_datums() override;
   OB_INLINE bool can_vectorized();
+  OB_INLINE bool is_runtime_filter() const { return filter_.is_runtime_filter(); }
+  // for runtime filter only, pass all rows of the micro block if the filter is not ready
+  int check_runtime_filter_pass_all(const int64_t row_count, bool &pass_all);
   int filter_batch(ObPushdownFilterExecutor *parent,
                    const int64_t start,
                    const int64_t end,
@@ -262,6 +262,42 @@ int ObExprJoinFilter::eval_bloom_filter_batch(
   return ret;
 }
 
+int ObExprJoinFilter::check_pass_all(const ObExpr &expr, ObEvalCtx &ctx,
+                                     const int64_t row_cnt, bool &pass_all)
+{
+  int ret = OB_SUCCESS;
+  ObExecContext &exec_ctx = ctx.exec_ctx_;
+  ObExprJoinFilterContext *join_filter_ctx = NULL;
+  pass_all = false;
+  if (OB_ISNULL(join_filter_ctx = static_cast<ObExprJoinFilterContext *>(
+            exec_ctx.get_expr_op_ctx(expr.expr_ctx_id_)))) {
+    // join filter ctx may be null in das.
+    pass_all = true;
+  } else if (join_filter_ctx->is_ready_ || join_filter_ctx->wait_ready_) {
+    // filter rows by evaluation, which waits the bloom filter if needed
+  } else {
+    // like the row path, look up and check the bloom filter once every CHECK_TIMES + 1 calls,
+    // a call here stands for a micro block.
+    const bool need_check = (join_filter_ctx->n_times_ & CHECK_TIMES) == 0;
+    ObPxBloomFilter *&bloom_filter_ptr_ = join_filter_ctx->bloom_filter_ptr_;
+    ++join_filter_ctx->n_times_;
+    if (OB_ISNULL(bloom_filter_ptr_) && need_check) {
+      if (OB_FAIL(ObPxBloomFilterManager::instance().get_px_bloom_filter(join_filter_ctx->bf_key_,
+            bloom_filter_ptr_))) {
+        ret = OB_SUCCESS;
+      }
+    }
+    if (need_check && OB_NOT_NULL(bloom_filter_ptr_) && bloom_filter_ptr_->check_ready()) {
+      join_filter_ctx->ready_ts_ = ObTimeUtility::current_time();
+      join_filter_ctx->is_ready_ = true;
+    } else {
+      pass_all = true;
+      join_filter_ctx->total_count_ += row_cnt;
+    }
+  }
+  return ret;
+}
+
 int ObExprJoinFilter::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const
 {
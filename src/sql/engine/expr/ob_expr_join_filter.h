@@ -50,6 +50,11 @@ public:
   static int eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res);
   static int eval_bloom_filter_batch(
              const ObExpr &expr, ObEvalCtx &ctx, const ObBitVector &skip, const int64_t batch_size);
+  // check whether the join filter can not filter any row now, e.g. the bloom filter
+  // is not ready and need not to wait for it. used by storage to skip the filter
+  // for a whole micro block without decoding the join key columns.
+  static int check_pass_all(const ObExpr &expr, ObEvalCtx &ctx,
+                            const int64_t row_cnt, bool &pass_all);
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
   virtual bool need_rt_ctx() const override { return true; }
@@ -1746,6 +1746,16 @@ int ObHashJoinOp::build_hash_table_in_memory(int64_t &num_left_rows)
     // do nothing
   } else {
     PartHashJoinTable &hash_table = *cur_hash_table_;
+    const int64_t radix_part_cnt = calc_radix_build_part_count(hash_table);
+    if (radix_part_cnt > 0) {
+      if (OB_FAIL(build_hash_table_by_radix(hj_batch, hash_table, radix_part_cnt,
+                                            num_left_rows))) {
+        LOG_WARN("failed to build hash table by radix", K(ret), K(radix_part_cnt));
+      } else {
+        // all rows are inserted, go on as the end of iteration
+        ret = OB_ITER_END;
+      }
+    }
     while (OB_SUCC(ret)) {
       int64_t read_size = 0;
       if (OB_FAIL(hj_batch->get_next_batch(left_stored_rows, PREFETCH_BATCH_SIZE, read_size))) {
@@ -1818,6 +1828,126 @@ int ObHashJoinOp::build_hash_table_in_memory(int64_t &num_left_rows)
   return ret;
 }
 
+// Radix partitioned build is used when the bucket array far exceeds L2 cache and the
+// partitioned row array fits in memory, shared hash table is built by multiple threads
+// and keep the original way.
+int64_t ObHashJoinOp::calc_radix_build_part_count(const PartHashJoinTable &hash_table)
+{
+  int64_t part_cnt = 0;
+  bool force_enable = false;
+  const int64_t bucket_size = hash_table.nbuckets_ * static_cast<int64_t>(sizeof(HTBucket));
+  const int64_t extra_mem_size = 2 * hash_table.row_count_ * static_cast<int64_t>(sizeof(void *));
+  uint64_t opt = std::abs(EVENT_CALL(EventTable::EN_HASH_JOIN_OPTION));
+  if (0 != opt) {
+    force_enable = !!(opt & HJ_TP_OPT_ENABLE_RADIX_BUILD);
+  }
+  if (is_shared_ || NULL == hash_table.buckets_ || 0 == hash_table.row_count_) {
+    // do nothing
+  } else if (force_enable) {
+    part_cnt = hash_table.nbuckets_ < RADIX_BUILD_MIN_PART_CNT
+               ? hash_table.nbuckets_ : RADIX_BUILD_MIN_PART_CNT;
+  } else if (0 != opt
+             || get_cur_mem_used() + extra_mem_size > sql_mem_processor_.get_mem_bound()) {
+    // do nothing
+  } else {
+    part_cnt = next_pow2(bucket_size / l2_cache_size_);
+    if (part_cnt < RADIX_BUILD_MIN_PART_CNT) {
+      part_cnt = 0;
+    } else if (part_cnt > RADIX_BUILD_MAX_PART_CNT) {
+      part_cnt = RADIX_BUILD_MAX_PART_CNT;
+    }
+  }
+  LOG_TRACE("trace radix build partition count", K(part_cnt), K(bucket_size),
+            K(extra_mem_size), K(hash_table.row_count_), K(l2_cache_size_));
+  return part_cnt;
+}
+
+// Insert build rows partition by partition, rows are partitioned by the high bits of the
+// bucket index, so the buckets visited by inserting one partition stay in L2 cache,
+// instead of random access to the whole bucket array.
+int ObHashJoinOp::build_hash_table_by_radix(ObHashJoinBatch *hj_batch,
+                                            PartHashJoinTable &hash_table,
+                                            const int64_t part_cnt,
+                                            int64_t &num_left_rows)
+{
+  int ret = OB_SUCCESS;
+  const int64_t READ_BATCH_SIZE = 64;
+  const int64_t PREFETCH_DISTANCE = 16;
+  const int64_t row_cnt = hash_table.row_count_;
+  const uint64_t mask = hash_table.nbuckets_ - 1;
+  const int64_t part_shift = __builtin_ctzll(hash_table.nbuckets_) - __builtin_ctzll(part_cnt);
+  const ObHashJoinStoredJoinRow **rows = NULL;
+  const ObHashJoinStoredJoinRow **part_rows = NULL;
+  int64_t *part_offsets = NULL;
+  num_left_rows = 0;
+  if (OB_UNLIKELY(part_cnt <= 0 || part_cnt > hash_table.nbuckets_ || 0 != (part_cnt & (part_cnt - 1)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid partition count", K(ret), K(part_cnt), K(hash_table.nbuckets_));
+  } else if (OB_ISNULL(rows = static_cast<const ObHashJoinStoredJoinRow **>(
+              alloc_->alloc(sizeof(*rows) * (row_cnt + READ_BATCH_SIZE))))
+             || OB_ISNULL(part_rows = static_cast<const ObHashJoinStoredJoinRow **>(
+              alloc_->alloc(sizeof(*part_rows) * row_cnt)))
+             || OB_ISNULL(part_offsets = static_cast<int64_t *>(
+              alloc_->alloc(sizeof(*part_offsets) * (part_cnt + 1))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to allocate memory", K(ret), K(row_cnt), K(part_cnt));
+  } else {
+    MEMSET(part_offsets, 0, sizeof(*part_offsets) * (part_cnt + 1));
+  }
+  // collect rows and the histogram of partitions
+  while (OB_SUCC(ret)) {
+    int64_t read_size = 0;
+    if (OB_FAIL(hj_batch->get_next_batch(rows + num_left_rows, READ_BATCH_SIZE, read_size))) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("get next batch failed", K(ret));
+      }
+    } else if (num_left_rows + read_size > row_cnt) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("row count exceed total row count", K(ret), K(num_left_rows + read_size), K(row_cnt));
+    } else {
+      for (int64_t i = num_left_rows; OB_SUCC(ret) && i < num_left_rows + read_size; ++i) {
+        const uint64_t hash_value = rows[i]->get_hash_value();
+        part_offsets[((hash_value & mask) >> part_shift) + 1] += 1;
+        if (enable_bloom_filter_ && OB_FAIL(bloom_filter_->set(hash_value))) {
+          LOG_WARN("add hash value to bloom failed", K(ret), K(i));
+        }
+      }
+      num_left_rows += read_size;
+    }
+  }
+  if (OB_ITER_END == ret) {
+    ret = OB_SUCCESS;
+    // scatter rows to partitions
+    for (int64_t i = 0; i < part_cnt; ++i) {
+      part_offsets[i + 1] += part_offsets[i];
+    }
+    for (int64_t i = 0; i < num_left_rows; ++i) {
+      const int64_t part_idx = (rows[i]->get_hash_value() & mask) >> part_shift;
+      part_rows[part_offsets[part_idx]++] = rows[i];
+    }
+    // partition rows are in order now, insert them one partition after another
+    for (int64_t i = 0; i < num_left_rows; ++i) {
+      if (i + PREFETCH_DISTANCE < num_left_rows) {
+        __builtin_prefetch(part_rows[i + PREFETCH_DISTANCE], 1 /* write */, 3 /* high temporal locality*/);
+      }
+      hash_table.set(part_rows[i]->get_hash_value(),
+                     const_cast<ObHashJoinStoredJoinRow *>(part_rows[i]));
+    }
+  }
+  if (NULL != rows) {
+    alloc_->free(rows);
+  }
+  if (NULL != part_rows) {
+    alloc_->free(part_rows);
+  }
+  if (NULL != part_offsets) {
+    alloc_->free(part_offsets);
+  }
+  LOG_TRACE("trace to finish radix build", K(ret), K(num_left_rows), K(part_cnt),
+            K(hash_table.nbuckets_));
+  return ret;
+}
+
 int ObHashJoinOp::in_memory_process(bool &need_not_read_right)
 {
   int ret = OB_SUCCESS;
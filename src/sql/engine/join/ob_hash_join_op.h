@@ -269,6 +269,7 @@ public:
   uint64_t HJ_TP_OPT_ENABLED = 1;
   uint64_t HJ_TP_OPT_ENABLE_CACHE_AWARE = 2;
   uint64_t HJ_TP_OPT_ENABLE_BLOOM_FILTER = 4;
+  uint64_t HJ_TP_OPT_ENABLE_RADIX_BUILD = 8;
 
   ObHashJoinOp(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOpInput *input);
   ~ObHashJoinOp() {}
@@ -1044,6 +1045,12 @@ private:
                       PredFunc pred);
 
   bool can_use_cache_aware_opt();
+  // return 0 if radix partitioned build is not needed
+  int64_t calc_radix_build_part_count(const PartHashJoinTable &hash_table);
+  int build_hash_table_by_radix(ObHashJoinBatch *hj_batch,
+                                PartHashJoinTable &hash_table,
+                                const int64_t part_cnt,
+                                int64_t &num_left_rows);
   int read_hashrow_normal();
   int read_hashrow_for_cache_aware(NextFunc next_func);
   int init_histograms(HashJoinHistogram *&part_histograms, int64_t part_count);
@@ -1087,6 +1094,10 @@ private:
   static const int64_t DEFAULT_MEM_LIMIT = 100 * 1024 * 1024;
 
   static const int64_t CACHE_AWARE_PART_CNT = 128;
+  // partition count bound of radix partitioned build, too many partitions make scatter
+  // TLB unfriendly.
+  static const int64_t RADIX_BUILD_MIN_PART_CNT = 16;
+  static const int64_t RADIX_BUILD_MAX_PART_CNT = 1024;
   static const int64_t BATCH_RESULT_SIZE = 512;
   static const int64_t INIT_LTB_SIZE = 64;
   static const int64_t INIT_L2_CACHE_SIZE = 1 * 1024 * 1024; // 1M
@@ -479,6 +479,7 @@ ObOperator::ObOperator(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOpInput
     io_event_observer_(op_monitor_info_),
     cpu_begin_time_(0),
     total_time_(0),
+    enable_hw_counter_(false),
     batch_reach_end_(false),
     row_reach_end_(false),
     output_batches_b4_rescan_(0),
@@ -486,6 +487,8 @@ ObOperator::ObOperator(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOpInput
 {
   eval_ctx_.max_batch_size_ = spec.max_batch_size_;
   eval_ctx_.batch_size_ = spec.max_batch_size_;
+  MEMSET(hw_begin_values_, 0, sizeof(hw_begin_values_));
+  MEMSET(hw_total_values_, 0, sizeof(hw_total_values_));
 }
 
 ObOperator::~ObOperator()
@@ -584,6 +587,8 @@ int ObOperator::open()
     if (ctx_.get_my_session()->is_user_session() || spec_.plan_->get_phy_plan_hint().monitor_) {
       IGNORE_RETURN try_register_rt_monitor_node(0);
     }
+    enable_hw_counter_ = GCONF._enable_sql_op_hw_counter
+        && NULL != ObHwPerfCounters::get_thread_counters();
     while (OB_SUCC(ret) && open_order != OPEN_EXIT) {
       switch (open_order) {
       case OPEN_CHILDREN_FIRST:
@@ -894,6 +899,9 @@ int ObOperator::submit_op_monitor_node()
         }
         // exclude io time cost
         op_monitor_info_.db_time_ = db_time;
+        if (enable_hw_counter_) {
+          fill_hw_counter_stats();
+        }
         IGNORE_RETURN list->submit_node(op_monitor_info_);
         LOG_DEBUG("debug monitor", K(spec_.id_));
       }
@@ -903,6 +911,30 @@ int ObOperator::submit_op_monitor_node()
   return ret;
 }
 
+void ObOperator::fill_hw_counter_stats()
+{
+  int64_t values[ObHwPerfCounters::MAX_COUNTER];
+  for (int64_t i = 0; i < ObHwPerfCounters::MAX_COUNTER; i++) {
+    // exclude counters of children, the same as db_time
+    values[i] = static_cast<int64_t>(hw_total_values_[i]);
+    if (!spec_.is_receive()) {
+      for (int64_t j = 0; j < child_cnt_; j++) {
+        values[i] -= static_cast<int64_t>(children_[j]->hw_total_values_[i]);
+      }
+    }
+    // children may be counted on threads without hardware counters
+    values[i] = MAX(0, values[i]);
+  }
+  op_monitor_info_.otherstat_7_id_ = ObSqlMonitorStatIds::HW_CPU_CYCLES;
+  op_monitor_info_.otherstat_7_value_ = values[ObHwPerfCounters::CPU_CYCLES];
+  op_monitor_info_.otherstat_8_id_ = ObSqlMonitorStatIds::HW_INSTRUCTIONS;
+  op_monitor_info_.otherstat_8_value_ = values[ObHwPerfCounters::INSTRUCTIONS];
+  op_monitor_info_.otherstat_9_id_ = ObSqlMonitorStatIds::HW_LLC_MISSES;
+  op_monitor_info_.otherstat_9_value_ = values[ObHwPerfCounters::LLC_MISSES];
+  op_monitor_info_.otherstat_10_id_ = ObSqlMonitorStatIds::HW_BRANCH_MISSES;
+  op_monitor_info_.otherstat_10_value_ = values[ObHwPerfCounters::BRANCH_MISSES];
+}
+
 int ObOperator::get_next_row()
 {
   int ret = OB_SUCCESS;
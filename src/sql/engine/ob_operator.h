@@ -16,6 +16,7 @@
 #include "lib/time/ob_tsc_timestamp.h"
 #include "lib/container/ob_fixed_array.h"
 #include "lib/ash/ob_active_session_guard.h"
+#include "lib/profile/ob_hw_perf_counter.h"
 #include "sql/engine/basic/ob_batch_result_holder.h"
 #include "sql/engine/ob_phy_operator_type.h"
 #include "sql/engine/expr/ob_expr.h"
@@ -604,10 +605,16 @@ protected:
     // begin with current operator
     ObActiveSessionGuard::get_stat().plan_line_id_ = spec_.id_;
     cpu_begin_time_ = rdtsc();
+    if (OB_UNLIKELY(enable_hw_counter_)) {
+      begin_hw_counting();
+    }
   }
   inline void end_cpu_time_counting()
   {
     total_time_ += (rdtsc() - cpu_begin_time_);
+    if (OB_UNLIKELY(enable_hw_counter_)) {
+      end_hw_counting();
+    }
     // move back to parent operator
     if (OB_LIKELY(spec_.get_parent())) {
       common::ObActiveSessionGuard::get_stat().plan_line_id_ = spec_.get_parent()->id_;
@@ -616,8 +623,34 @@ protected:
     }
   }
 
+  inline void begin_hw_counting()
+  {
+    common::ObHwPerfCounters *counters = common::ObHwPerfCounters::get_thread_counters();
+    if (OB_NOT_NULL(counters)) {
+      counters->read(hw_begin_values_);
+    }
+  }
+  inline void end_hw_counting()
+  {
+    common::ObHwPerfCounters *counters = common::ObHwPerfCounters::get_thread_counters();
+    if (OB_NOT_NULL(counters)) {
+      uint64_t values[common::ObHwPerfCounters::MAX_COUNTER];
+      counters->read(values);
+      for (int64_t i = 0; i < common::ObHwPerfCounters::MAX_COUNTER; i++) {
+        hw_total_values_[i] += values[i] - hw_begin_values_[i];
+      }
+    }
+  }
+  void fill_hw_counter_stats();
+
   uint64_t cpu_begin_time_; // start of counting cpu time
   uint64_t total_time_; //  total time cost on this op, including io & cpu time
+  bool enable_hw_counter_;
+  // hardware counters of this op, including children, like total_time_.
+  // Values are raw counts, they are not scaled by time_enabled/time_running
+  // when the kernel multiplexes more events than the PMU has counters.
+  uint64_t hw_begin_values_[common::ObHwPerfCounters::MAX_COUNTER];
+  uint64_t hw_total_values_[common::ObHwPerfCounters::MAX_COUNTER];
 protected:
   bool batch_reach_end_;
   bool row_reach_end_;
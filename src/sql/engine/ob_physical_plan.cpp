@@ -118,7 +118,8 @@ ObPhysicalPlan::ObPhysicalPlan(MemoryContext &mem_context /* = CURRENT_CONTEXT *
     ddl_execution_id_(-1),
     ddl_task_id_(0),
     is_packed_(false),
-    has_instead_of_trigger_(false)
+    has_instead_of_trigger_(false),
+    enable_result_cache_(false)
 {
 }
 
@@ -200,6 +201,7 @@ void ObPhysicalPlan::reset()
   contain_pl_udf_or_trigger_ = false;
   is_packed_ = false;
   has_instead_of_trigger_ = false;
+  enable_result_cache_ = false;
   stat_.expected_worker_map_.destroy();
   stat_.minimal_worker_map_.destroy();
 }
@@ -437,6 +437,8 @@ public:
   bool is_packed() const { return is_packed_; }
   void set_has_instead_of_trigger(bool v) { has_instead_of_trigger_ = v;}
   bool has_instead_of_trigger() const { return has_instead_of_trigger_; }
+  void set_enable_result_cache(bool v) { enable_result_cache_ = v; }
+  bool enable_result_cache() const { return enable_result_cache_; }
   virtual int update_cache_obj_stat(ObILibCacheCtx &ctx);
   void calc_whether_need_trans();
 public:
@@ -600,6 +602,7 @@ public:
   //parallel encoding of output_expr in advance to speed up packet response
   bool is_packed_;
   bool has_instead_of_trigger_; // mask if has instead of trigger on view
+  bool enable_result_cache_; // RESULT_CACHE hint on a deterministic query, not serialized
 };
 
 inline void ObPhysicalPlan::set_affected_last_insert_id(bool affected_last_insert_id)
@@ -29,7 +29,8 @@ namespace sql
 OB_SERIALIZE_MEMBER((ObPxDistTransmitOpInput, ObPxTransmitOpInput));
 
 OB_SERIALIZE_MEMBER((ObPxDistTransmitSpec, ObPxTransmitSpec), dist_exprs_,
-    dist_hash_funcs_, sort_cmp_funs_, sort_collations_, calc_tablet_id_expr_);
+    dist_hash_funcs_, sort_cmp_funs_, sort_collations_, calc_tablet_id_expr_,
+    popular_hash_vals_);
 
 int ObPxDistTransmitOp::inner_open()
 {
@@ -186,6 +187,18 @@ int ObPxDistTransmitOp::do_transmit()
         }
         break;
       }
+      case ObPQDistributeMethod::HYBRID_HASH_BROADCAST: {
+        if (OB_FAIL(do_hybrid_hash_broadcast_dist())) {
+          LOG_WARN("do hybrid hash broadcast distribution failed",  K(ret));
+        }
+        break;
+      }
+      case ObPQDistributeMethod::HYBRID_HASH_RANDOM: {
+        if (OB_FAIL(do_hybrid_hash_random_dist())) {
+          LOG_WARN("do hybrid hash random distribution failed",  K(ret));
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_USER_ERROR(OB_NOT_SUPPORTED, "this transmit distribution method");
@@ -222,6 +235,36 @@ int ObPxDistTransmitOp::do_hash_dist()
   return ret;
 }
 
+int ObPxDistTransmitOp::do_hybrid_hash_broadcast_dist()
+{
+  int ret = OB_SUCCESS;
+  ObHybridHashBroadcastSliceIdCalc slice_id_calc(ctx_.get_allocator(),
+                                                 task_channels_.count(),
+                                                 MY_SPEC.null_row_dist_method_,
+                                                 &MY_SPEC.dist_exprs_,
+                                                 &MY_SPEC.dist_hash_funcs_,
+                                                 &MY_SPEC.popular_hash_vals_);
+  if (OB_FAIL(send_rows(slice_id_calc))) {
+    LOG_WARN("row distribution failed", K(ret));
+  }
+  return ret;
+}
+
+int ObPxDistTransmitOp::do_hybrid_hash_random_dist()
+{
+  int ret = OB_SUCCESS;
+  ObHybridHashRandomSliceIdCalc slice_id_calc(ctx_.get_allocator(),
+                                              task_channels_.count(),
+                                              MY_SPEC.null_row_dist_method_,
+                                              &MY_SPEC.dist_exprs_,
+                                              &MY_SPEC.dist_hash_funcs_,
+                                              &MY_SPEC.popular_hash_vals_);
+  if (OB_FAIL(send_rows(slice_id_calc))) {
+    LOG_WARN("row distribution failed", K(ret));
+  }
+  return ret;
+}
+
 int ObPxDistTransmitOp::do_bc2host_dist()
 {
   int ret = OB_SUCCESS;
@@ -43,7 +43,8 @@ public:
     dist_hash_funcs_(alloc),
     sort_cmp_funs_(alloc),
     sort_collations_(alloc),
-    calc_tablet_id_expr_(NULL)
+    calc_tablet_id_expr_(NULL),
+    popular_hash_vals_(alloc)
   {}
   ~ObPxDistTransmitSpec() {}
   virtual int register_to_datahub(ObExecContext &ctx) const override;
@@ -52,6 +53,8 @@ public:
   ObSortFuncs sort_cmp_funs_;
   ObSortCollations sort_collations_;
   ObExpr *calc_tablet_id_expr_;   // for slave mapping
+  // hash values of popular join key values, for hybrid hash distribution
+  ObFixedArray<uint64_t, common::ObIAllocator> popular_hash_vals_;
 };
 
 class ObPxDistTransmitOp : public ObPxTransmitOp
@@ -16,6 +16,7 @@
 #include "sql/engine/ob_physical_plan.h"
 #include "sql/engine/ob_exec_context.h"
 #include "sql/engine/px/ob_granule_pump.h"
+#include "sql/engine/px/ob_px_sqc_handler.h"
 #include "sql/executor/ob_task_spliter.h"
 #include "sql/engine/dml/ob_table_insert_op.h"
 #include "sql/engine/expr/ob_expr_join_filter.h"
@@ -282,6 +283,9 @@ int ObGranuleIteratorOp::try_fetch_task(ObGranuleTaskInfo &info)
       } else if (OB_FAIL(rescan_tasks_.push_back(pos))) {
         LOG_WARN("array push back failed", K(ret));
       } else {
+        if (from_share_pool && OB_NOT_NULL(ctx_.get_sqc_handler())) {
+          ctx_.get_sqc_handler()->get_sub_coord().try_grow_adaptive_dop();
+        }
         if (NULL == rescan_taskset_) {
           rescan_taskset_ = taskset;
         } else if (rescan_taskset_ != taskset) {
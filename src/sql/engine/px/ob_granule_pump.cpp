@@ -203,6 +203,52 @@ int ObGITaskSet::set_block_order(bool desc)
   return ret;
 }
 
+int ObGITaskSet::set_tablet_size_order(const ObIArray<ObPxTabletInfo> &tablets_info)
+{
+  int ret = OB_SUCCESS;
+  if (gi_task_set_.count() > 1 && !tablets_info.empty()) {
+    // <physical_row_count, pos>
+    typedef std::pair<int64_t, int64_t> TaskSize;
+    common::ObArray<TaskSize> task_sizes;
+    common::ObArray<ObGITaskInfo> ordered_task_info;
+    if (OB_FAIL(task_sizes.reserve(gi_task_set_.count()))) {
+      LOG_WARN("fail reserve memory for array", K(ret));
+    } else if (OB_FAIL(ordered_task_info.reserve(gi_task_set_.count()))) {
+      LOG_WARN("fail reserve memory for array", K(ret));
+    }
+    ARRAY_FOREACH(gi_task_set_, idx) {
+      const int64_t tablet_id = gi_task_set_.at(idx).tablet_loc_->tablet_id_.id();
+      int64_t row_count = 0;
+      ARRAY_FOREACH_NORET(tablets_info, i) {
+        if (tablets_info.at(i).tablet_id_ == tablet_id) {
+          row_count = tablets_info.at(i).physical_row_count_;
+          break;
+        }
+      }
+      if (OB_FAIL(task_sizes.push_back(TaskSize(row_count, idx)))) {
+        LOG_WARN("failed to push back task size", K(ret));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      // stable sort keeps tasks of the same tablet in their block order
+      auto compare_fun = [](const TaskSize &a, const TaskSize &b) -> bool { return a.first > b.first; };
+      std::stable_sort(task_sizes.begin(), task_sizes.end(), compare_fun);
+      ARRAY_FOREACH(task_sizes, idx) {
+        if (OB_FAIL(ordered_task_info.push_back(gi_task_set_.at(task_sizes.at(idx).second)))) {
+          LOG_WARN("failed to push back task info", K(ret));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      if (OB_FAIL(gi_task_set_.assign(ordered_task_info))) {
+        LOG_WARN("failed to assign task info", K(ret));
+      }
+    }
+    LOG_TRACE("tablet size order task info", K(ret), K(gi_task_set_));
+  }
+  return ret;
+}
+
 int ObGITaskSet::construct_taskset(ObIArray<ObDASTabletLoc*> &taskset_tablets,
                                    ObIArray<ObNewRange> &taskset_ranges,
                                    ObIArray<ObNewRange> &ss_ranges,
@@ -377,8 +423,11 @@ int ObGranulePump::fetch_granule_from_shared_pool(const ObGITaskSet *&res_task_s
           LOG_WARN("fail to get next gi task pos", K(ret));
         } else {
           no_more_task_from_shared_pool_ = true;
+          ATOMIC_STORE(&shared_pool_remain_count_, 0);
         }
       } else {
+        ATOMIC_STORE(&shared_pool_fetched_count_, taskset.cur_pos_);
+        ATOMIC_STORE(&shared_pool_remain_count_, taskset.gi_task_set_.count() - taskset.cur_pos_);
         LOG_TRACE("get GI task", K(taskset), K(ret));
       }
     }
@@ -905,6 +954,11 @@ int ObRandomGranuleSplitter::split_granule(ObGranulePumpArgs &args,
         LOG_WARN("failed to init granule iter pump", K(ret), K(idx), K(tablet_arrays));
       } else if (OB_FAIL(total_task_set.set_block_order(args.desc_order()))) {
         LOG_WARN("fail set block order", K(ret));
+      } else if (partition_granule
+                 && ObGITaskSet::GI_RANDOM_NONE == random_type
+                 && !args.asc_order() && !args.desc_order()
+                 && OB_FAIL(total_task_set.set_tablet_size_order(args.partitions_info_))) {
+        LOG_WARN("fail set tablet size order", K(ret));
       } else if (OB_FAIL(taskset_array.push_back(total_task_set))) {
         LOG_WARN("failed to push back task set", K(ret));
       } else {
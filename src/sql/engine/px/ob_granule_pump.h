@@ -127,6 +127,9 @@ public:
   int assign(const ObGITaskSet &other);
   int set_pw_affi_partition_order(bool asc);
   int set_block_order(bool asc);
+  // put tasks of larger tablets ahead, so that stragglers on skewed
+  // tablets start first when workers pull tasks from shared pool.
+  int set_tablet_size_order(const common::ObIArray<ObPxTabletInfo> &tablets_info);
   int construct_taskset(common::ObIArray<ObDASTabletLoc*> &taskset_tablets,
                         common::ObIArray<ObNewRange> &taskset_ranges,
                         common::ObIArray<ObNewRange> &ss_ranges,
@@ -441,7 +444,9 @@ public:
   need_partition_pruning_(false),
   pruning_table_locations_(),
   pump_version_(0),
-  is_taskset_reset_(false)
+  is_taskset_reset_(false),
+  shared_pool_fetched_count_(0),
+  shared_pool_remain_count_(0)
   {
   }
 
@@ -483,6 +488,11 @@ public:
                           int64_t worker_id);
 
   int64_t get_pump_version() const { return pump_version_; }
+  // granules in the shared pool handed out so far and still waiting, refreshed
+  // on every fetch. used by the sqc to decide whether to add workers.
+  bool is_shared_pool_splitter() const { return GIT_RANDOM == splitter_type_; }
+  int64_t get_shared_pool_fetched_count() const { return ATOMIC_LOAD(&shared_pool_fetched_count_); }
+  int64_t get_shared_pool_remain_count() const { return ATOMIC_LOAD(&shared_pool_remain_count_); }
   bool is_taskset_reset() const { return is_taskset_reset_; }
   DECLARE_TO_STRING;
 public:
@@ -548,6 +558,8 @@ private:
   int64_t pump_version_;
 
   bool is_taskset_reset_;
+  int64_t shared_pool_fetched_count_;
+  int64_t shared_pool_remain_count_;
 };
 
 }//sql
@@ -40,7 +40,7 @@ int ObPxWorkNotifier::wait_all_worker_start()
    * 如果丢了信号，则wait一段时间，
    * 如果未丢信号量，则是直接被唤醒。
    */
-  while (start_worker_count_ != expect_worker_count_) {
+  while (start_worker_count_ < start_wait_count_) {
     cond_.wait(wait_key, wait_us);
   }
   return ret;
@@ -49,7 +49,7 @@ int ObPxWorkNotifier::wait_all_worker_start()
 void ObPxWorkNotifier::worker_start(int64_t tid)
 {
   int64_t start_worker_count = ATOMIC_AAF(&start_worker_count_, 1);
-  if (start_worker_count == expect_worker_count_) {
+  if (start_worker_count == start_wait_count_) {
     // notify rpc worker to exit
     cond_.signal();
   }
@@ -78,6 +78,7 @@ int ObPxWorkNotifier::set_expect_worker_count(int64_t worker_count)
     LOG_WARN("failed to prepare allocate worker", K(ret));
   } else {
     expect_worker_count_ = worker_count;
+    start_wait_count_ = worker_count;
   }
   return ret;
 }
@@ -32,25 +32,28 @@ class ObPxWorkNotifier
 {
 public:
   ObPxWorkNotifier() : start_worker_count_(0), finish_worker_count_(0),
-  expect_worker_count_(0), cond_() {}
+  expect_worker_count_(0), start_wait_count_(0), cond_() {}
   ~ObPxWorkNotifier() = default;
 
   int wait_all_worker_start();
 
   void worker_start(int64_t tid);
-  inline void worker_end(bool &all_worker_finish);
+  void worker_end(bool &all_worker_finish);
 
   int set_expect_worker_count(int64_t worker_count);
+  // 自适应并行时只有部分 worker 在 sqc 启动时被调度，rpc 线程只需等待这部分 worker 启动
+  void set_start_wait_count(int64_t worker_count) { start_wait_count_ = worker_count; }
 
   const common::ObIArray<int64_t> &worker_thread_info() { return tid_array_; }
 
   TO_STRING_KV(K_(start_worker_count), K_(finish_worker_count),
-      K_(expect_worker_count), K_(tid_array))
+      K_(expect_worker_count), K_(start_wait_count), K_(tid_array))
 
 private:
   volatile int64_t start_worker_count_;
   volatile int64_t finish_worker_count_;
   int64_t expect_worker_count_;
+  int64_t start_wait_count_;
   common::SimpleCond cond_;
   // 为了方面追踪rpc启动的是哪些worker
   common::ObArray<int64_t> tid_array_;
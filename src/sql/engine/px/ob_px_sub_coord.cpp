@@ -41,6 +41,7 @@
 #include "storage/ddl/ob_direct_insert_sstable_ctx.h"
 #include "sql/engine/px/ob_granule_pump.h"
 #include "sql/das/ob_das_utils.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::sql;
@@ -48,6 +49,78 @@ using namespace oceanbase::share;
 using namespace oceanbase::sql::dtl;
 using namespace oceanbase::storage;
 
+void ObPxDeferredTaskSet::init(int64_t task_count)
+{
+  ObLockGuard<ObSpinLock> lock_guard(lock_);
+  is_open_ = false;
+  // nothing can be claimed until opened
+  next_task_idx_ = task_count;
+  task_count_ = task_count;
+  start_all_pending_ = false;
+  pending_ret_ = OB_SUCCESS;
+}
+
+void ObPxDeferredTaskSet::open(int64_t start_task_count,
+                               int64_t &start_idx,
+                               int64_t &end_idx,
+                               int &skip_ret)
+{
+  ObLockGuard<ObSpinLock> lock_guard(lock_);
+  is_open_ = true;
+  next_task_idx_ = MIN(start_task_count, task_count_);
+  start_idx = next_task_idx_;
+  end_idx = next_task_idx_;
+  skip_ret = OB_SUCCESS;
+  if (start_all_pending_) {
+    end_idx = task_count_;
+    next_task_idx_ = task_count_;
+    skip_ret = pending_ret_;
+  }
+}
+
+bool ObPxDeferredTaskSet::try_claim_one(int64_t &task_idx)
+{
+  bool claimed = false;
+  if (OB_SUCCESS == lock_.trylock()) {
+    if (is_open_ && next_task_idx_ < task_count_) {
+      task_idx = next_task_idx_++;
+      claimed = true;
+    }
+    lock_.unlock();
+  }
+  return claimed;
+}
+
+void ObPxDeferredTaskSet::claim_all(int skip_ret, int64_t &start_idx, int64_t &end_idx)
+{
+  ObLockGuard<ObSpinLock> lock_guard(lock_);
+  start_idx = 0;
+  end_idx = 0;
+  if (!is_open_) {
+    start_all_pending_ = true;
+    if (OB_SUCCESS == pending_ret_) {
+      pending_ret_ = skip_ret;
+    }
+  } else {
+    start_idx = next_task_idx_;
+    end_idx = task_count_;
+    next_task_idx_ = task_count_;
+  }
+}
+
+bool ObPxDeferredTaskSet::claim_one(int64_t &task_idx)
+{
+  bool claimed = false;
+  ObLockGuard<ObSpinLock> lock_guard(lock_);
+  if (!is_open_) {
+    start_all_pending_ = true;
+  } else if (next_task_idx_ < task_count_) {
+    task_idx = next_task_idx_++;
+    claimed = true;
+  }
+  return claimed;
+}
+
 // Note: 每个线程里的 Task 是对等的，唯一不同的是
 // 他们从 granule 中 "抢" 到的任务范围不同
 int ObPxSubCoord::pre_process()
@@ -103,6 +176,10 @@ int ObPxSubCoord::pre_process()
     OZ(sqc_ctx_.gi_pump_.set_pruning_table_location(sqc_arg_.sqc_.get_pruning_table_locations()));
   }
 
+  if (OB_SUCC(ret) && OB_FAIL(init_adaptive_dop())) {
+    LOG_WARN("fail to init adaptive dop", K(ret));
+  }
+
   if (OB_FAIL(ret)) {
     // 通知 qc 中断事件
     if (IS_INTERRUPTED()) {
@@ -511,8 +588,17 @@ int ObPxSubCoord::dispatch_tasks(ObPxRpcInitSqcArgs &sqc_arg, ObSqcCtx &sqc_ctx,
     dispatch_worker_count = 0;
     ret = dispatch_task_to_local_thread(sqc_arg, sqc_ctx, sqc);
   } else {
-    // execute all task in thread pool, non-block call
-    for (int64_t i = 0; OB_SUCC(ret) && i < sqc.get_task_count(); ++i) {
+    // execute all task in thread pool, non-block call.
+    // with adaptive dop only the first part of tasks are started here, the deferred
+    // tasks can not be claimed by the started workers before we are done.
+    const bool is_adaptive = adaptive_start_task_count_ > 0;
+    const int64_t start_task_count = is_adaptive ? adaptive_start_task_count_ : sqc.get_task_count();
+    if (is_adaptive) {
+      adaptive_start_ts_ = ObTimeUtility::current_time();
+      last_grow_ts_ = adaptive_start_ts_;
+      sqc_arg.sqc_handler_->get_notifier().set_start_wait_count(start_task_count);
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < start_task_count; ++i) {
       sqc_arg.sqc_handler_->inc_ref_count();
       ret = dispatch_task_to_thread_pool(sqc_arg, sqc_ctx, sqc, i);
       if (OB_SUCC(ret)) {
@@ -521,10 +607,175 @@ int ObPxSubCoord::dispatch_tasks(ObPxRpcInitSqcArgs &sqc_arg, ObSqcCtx &sqc_ctx,
         sqc_arg.sqc_handler_->dec_ref_count();
       }
     }
+    // on failure the dispatched workers are interrupted by rpc thread, never start the rest
+    if (OB_SUCC(ret) && is_adaptive) {
+      int64_t start_idx = 0;
+      int64_t end_idx = 0;
+      int skip_ret = OB_SUCCESS;
+      deferred_tasks_.open(dispatch_worker_count, start_idx, end_idx, skip_ret);
+      start_claimed_tasks(start_idx, end_idx, skip_ret);
+    }
   }
   return ret;
 }
 
+int ObPxSubCoord::init_adaptive_dop()
+{
+  int ret = OB_SUCCESS;
+  ObPxSqcMeta &sqc = sqc_arg_.sqc_;
+  const int64_t task_count = sqc.get_task_count();
+  int64_t gi_count = 0;
+  bool can_adapt = true;
+  adaptive_start_task_count_ = 0;
+  if (sqc.is_rpc_worker() || task_count <= 1) {
+    // single task, nothing to adapt
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (!tenant_config.is_valid() || !tenant_config->_enable_px_adaptive_dop) {
+      // adaptive dop disabled
+    } else if (OB_FAIL(check_adaptive_dop(*sqc_arg_.op_spec_root_, gi_count, can_adapt))) {
+      LOG_WARN("fail to check adaptive dop", K(ret));
+    } else if (can_adapt
+               && 1 == gi_count
+               && sqc_ctx_.whole_msg_provider_list_.empty()
+               && sqc_ctx_.gi_pump_.is_shared_pool_splitter()) {
+      const int64_t start_pct = tenant_config->_px_adaptive_dop_start_pct;
+      const int64_t start_task_count = MAX(1, task_count * start_pct / 100);
+      if (start_task_count < task_count) {
+        adaptive_start_task_count_ = start_task_count;
+        deferred_tasks_.init(task_count);
+      }
+    }
+  }
+  LOG_TRACE("init adaptive dop", K(ret), K(task_count), K(gi_count), K(can_adapt),
+            K_(adaptive_start_task_count));
+  return ret;
+}
+
+// deferred tasks start late, so no task of the dfo may wait for its sibling tasks
+// (datahub, shared hash table, join filter) or for a child dfo (receive).
+int ObPxSubCoord::check_adaptive_dop(const ObOpSpec &root, int64_t &gi_count, bool &can_adapt) const
+{
+  int ret = OB_SUCCESS;
+  const ObPhyOperatorType type = root.get_type();
+  if (IS_PX_RECEIVE(type)
+      || IS_PX_BLOOM_FILTER(type)
+      || IS_DML(type)
+      || IS_PX_MODIFY(type)
+      || PHY_TEMP_TABLE_INSERT == type
+      || (PHY_HASH_JOIN == type && static_cast<const ObHashJoinSpec &>(root).is_shared_ht_)) {
+    can_adapt = false;
+  } else {
+    if (IS_PX_GI(type)) {
+      ++gi_count;
+    }
+    for (int32_t i = 0; OB_SUCC(ret) && can_adapt && i < root.get_child_cnt(); ++i) {
+      const ObOpSpec *child = root.get_child(i);
+      if (OB_ISNULL(child)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("NULL child op unexpected", K(ret));
+      } else if (OB_FAIL(SMART_CALL(check_adaptive_dop(*child, gi_count, can_adapt)))) {
+        LOG_WARN("fail to check adaptive dop", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+void ObPxSubCoord::try_grow_adaptive_dop()
+{
+  if (adaptive_start_task_count_ > 0 && deferred_tasks_.has_unclaimed()) {
+    const int64_t now = ObTimeUtility::current_time();
+    const int64_t elapsed = now - adaptive_start_ts_;
+    const int64_t fetched = sqc_ctx_.gi_pump_.get_shared_pool_fetched_count();
+    const int64_t remain = sqc_ctx_.gi_pump_.get_shared_pool_remain_count();
+    int64_t task_idx = 0;
+    // add a worker only if there are more granules than workers and, at the rate
+    // granules are consumed so far, draining them takes longer than the interval.
+    if (now - last_grow_ts_ >= ADAPTIVE_DOP_GROW_INTERVAL
+        && remain > deferred_tasks_.get_next_task_idx()
+        && fetched > 0
+        && elapsed * remain > ADAPTIVE_DOP_GROW_INTERVAL * fetched
+        && deferred_tasks_.try_claim_one(task_idx)) {
+      int ret = OB_SUCCESS;
+      last_grow_ts_ = now;
+      if (OB_FAIL(dispatch_deferred_task(task_idx))) {
+        LOG_WARN("fail to dispatch deferred task", K(ret), K(task_idx));
+        skip_deferred_task(task_idx, ret);
+      } else {
+        LOG_TRACE("adaptive dop grow", K(task_idx), K(fetched), K(remain), K(elapsed));
+      }
+    }
+  }
+}
+
+bool ObPxSubCoord::claim_deferred_task(int skip_ret, ObPxRpcInitTaskArgs &args)
+{
+  int ret = OB_SUCCESS;
+  bool claimed = false;
+  int64_t task_idx = 0;
+  ObPxTask *task_ptr = nullptr;
+  if (adaptive_start_task_count_ <= 0) {
+    // adaptive dop is off
+  } else if (OB_SUCCESS != skip_ret) {
+    skip_deferred_tasks(skip_ret);
+  } else if (!deferred_tasks_.claim_one(task_idx)) {
+    // nothing left, or the set is not open yet and the sqc starts the rest
+  } else if (OB_FAIL(init_task_args(sqc_arg_, sqc_ctx_, task_idx, args, task_ptr))) {
+    LOG_WARN("fail to init deferred task args", K(ret), K(task_idx));
+    skip_deferred_task(task_idx, ret);
+    skip_deferred_tasks(ret);
+  } else {
+    claimed = true;
+    LOG_TRACE("run deferred task in exiting worker", K(task_idx));
+  }
+  return claimed;
+}
+
+void ObPxSubCoord::skip_deferred_tasks(int skip_ret)
+{
+  // the set may not be open yet, the claim is left to the sqc then
+  int64_t start_idx = 0;
+  int64_t end_idx = 0;
+  deferred_tasks_.claim_all(skip_ret, start_idx, end_idx);
+  start_claimed_tasks(start_idx, end_idx, skip_ret);
+}
+
+void ObPxSubCoord::start_claimed_tasks(int64_t start_idx, int64_t end_idx, int skip_ret)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t task_idx = start_idx; task_idx < end_idx; ++task_idx) {
+    if (OB_SUCCESS != skip_ret) {
+      skip_deferred_task(task_idx, skip_ret);
+    } else if (OB_FAIL(dispatch_deferred_task(task_idx))) {
+      LOG_WARN("fail to dispatch deferred task", K(ret), K(task_idx));
+      skip_deferred_task(task_idx, ret);
+      skip_ret = ret;
+    }
+  }
+}
+
+int ObPxSubCoord::dispatch_deferred_task(int64_t task_idx)
+{
+  int ret = OB_SUCCESS;
+  sqc_arg_.sqc_handler_->inc_ref_count();
+  if (OB_FAIL(dispatch_task_to_thread_pool(sqc_arg_, sqc_ctx_, sqc_arg_.sqc_, task_idx))) {
+    sqc_arg_.sqc_handler_->dec_ref_count();
+  }
+  return ret;
+}
+
+// the task never runs, account it as finished so that the sqc can end
+void ObPxSubCoord::skip_deferred_task(int64_t task_idx, int skip_ret)
+{
+  ObPxTask *task_ptr = nullptr;
+  if (OB_SUCCESS == sqc_ctx_.get_task(task_idx, task_ptr) && OB_NOT_NULL(task_ptr)) {
+    task_ptr->set_result(skip_ret);
+    task_ptr->set_task_state(SQC_TASK_EXIT);
+  }
+  IGNORE_RETURN sqc_arg_.sqc_handler_->worker_end_hook();
+}
+
 
 int ObPxSubCoord::dispatch_task_to_local_thread(ObPxRpcInitSqcArgs &sqc_arg,
                                                 ObSqcCtx &sqc_ctx,
@@ -564,16 +815,14 @@ int ObPxSubCoord::dispatch_task_to_local_thread(ObPxRpcInitSqcArgs &sqc_arg,
   return ret;
 }
 
-int ObPxSubCoord::dispatch_task_to_thread_pool(ObPxRpcInitSqcArgs &sqc_arg,
-                                              ObSqcCtx &sqc_ctx,
-                                              ObPxSqcMeta &sqc,
-                                              int64_t task_idx)
-
+int ObPxSubCoord::init_task_args(ObPxRpcInitSqcArgs &sqc_arg,
+                                 ObSqcCtx &sqc_ctx,
+                                 int64_t task_idx,
+                                 ObPxRpcInitTaskArgs &args,
+                                 ObPxTask *&task_ptr)
 {
   int ret = OB_SUCCESS;
-  ObPxRpcInitTaskArgs args;
-  ObPxTask *task_ptr = nullptr;
-  ObPxWorkerRunnable *worker = nullptr;
+  task_ptr = nullptr;
   if (OB_FAIL(sqc_ctx.get_task(task_idx, task_ptr))) {
     LOG_ERROR("fail add task. should always SUCC as mem reserved", K(ret));
   } else if (OB_ISNULL(task_ptr)) {
@@ -593,9 +842,21 @@ int ObPxSubCoord::dispatch_task_to_thread_pool(ObPxRpcInitSqcArgs &sqc_arg,
     //记录开始调度task的时间
     args.sqc_handler_ = sqc_arg.sqc_handler_;
   }
+  return ret;
+}
 
-  if (OB_FAIL(ret)) {
-    // fail
+int ObPxSubCoord::dispatch_task_to_thread_pool(ObPxRpcInitSqcArgs &sqc_arg,
+                                              ObSqcCtx &sqc_ctx,
+                                              ObPxSqcMeta &sqc,
+                                              int64_t task_idx)
+
+{
+  int ret = OB_SUCCESS;
+  ObPxRpcInitTaskArgs args;
+  ObPxTask *task_ptr = nullptr;
+  ObPxWorkerRunnable *worker = nullptr;
+  if (OB_FAIL(init_task_args(sqc_arg, sqc_ctx, task_idx, args, task_ptr))) {
+    LOG_WARN("fail to init task args", K(ret), K(task_idx));
   } else if (OB_ISNULL(worker =
       static_cast<ObPxWorkerRunnable *>(thread_worker_factory_.create_worker()))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
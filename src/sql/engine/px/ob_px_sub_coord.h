@@ -40,6 +40,50 @@ namespace sql
 {
 class ObPxSQCHandler;
 
+// Tasks deferred by adaptive dop. A task is claimed under the lock and dispatched or
+// skipped by the claimer after the lock is released, the lock is never held while
+// acquiring a worker thread. Nothing can be claimed before the sqc dispatched the
+// first tasks, a worker exiting before that leaves the rest to be started by the sqc.
+// Tasks claimed by an exiting worker are run one by one in that worker's own thread.
+class ObPxDeferredTaskSet
+{
+public:
+  ObPxDeferredTaskSet()
+      : lock_(),
+        is_open_(false),
+        next_task_idx_(0),
+        task_count_(0),
+        start_all_pending_(false),
+        pending_ret_(common::OB_SUCCESS)
+  {}
+  ~ObPxDeferredTaskSet() = default;
+  void init(int64_t task_count);
+  // called by sqc after the first %start_task_count tasks are dispatched, returns the
+  // tasks claimed by a worker exiting before, they are started or skipped with %skip_ret.
+  void open(int64_t start_task_count, int64_t &start_idx, int64_t &end_idx, int &skip_ret);
+  // never waits for the lock, returns false if no task is claimed
+  bool try_claim_one(int64_t &task_idx);
+  // claim all remaining tasks in [start_idx, end_idx)
+  void claim_all(int skip_ret, int64_t &start_idx, int64_t &end_idx);
+  // claim the next task for a worker about to exit, which runs it in its own thread.
+  // returns false if no task is left or the set is not open yet, the remaining
+  // tasks are left to the sqc then.
+  bool claim_one(int64_t &task_idx);
+  bool has_unclaimed() const { return next_task_idx_ < task_count_; }
+  // tasks with index less than it are dispatched
+  int64_t get_next_task_idx() const { return next_task_idx_; }
+  TO_STRING_KV(K_(is_open), K_(next_task_idx), K_(task_count), K_(start_all_pending),
+               K_(pending_ret));
+private:
+  common::ObSpinLock lock_;
+  bool is_open_;
+  volatile int64_t next_task_idx_;
+  int64_t task_count_;
+  bool start_all_pending_;
+  int pending_ret_;
+  DISALLOW_COPY_AND_ASSIGN(ObPxDeferredTaskSet);
+};
+
 class ObPxSubCoord
 {
 public:
@@ -52,7 +96,11 @@ public:
         local_worker_factory_(gctx, allocator_),
         thread_worker_factory_(gctx, allocator_),
         first_buffer_cache_(allocator_),
-        bf_key_()
+        bf_key_(),
+        deferred_tasks_(),
+        adaptive_start_task_count_(0),
+        adaptive_start_ts_(0),
+        last_grow_ts_(0)
   {}
   virtual ~ObPxSubCoord() = default;
   int pre_process();
@@ -80,7 +128,24 @@ public:
   int64_t get_ddl_context_id() const { return ddl_ctrl_.context_id_; }
 
   int init_px_bloom_filter_advance(ObExecContext *ctx, ObOpSpec *root);
+
+  // adaptive dop: a leaf scan dfo starts part of its tasks, the rest are deferred.
+  // called by worker after each granule fetched, start one more deferred task when
+  // the remaining granules can not be drained quickly by the running workers.
+  void try_grow_adaptive_dop();
+  // called by worker before exit. every task must finish to close its channels,
+  // the granules are drained by then, so the worker runs the deferred tasks one by
+  // one in its own thread instead of taking a new thread for each of them. returns
+  // true with the args of the next task to run, or skips all of them on error.
+  bool claim_deferred_task(int skip_ret, ObPxRpcInitTaskArgs &args);
 private:
+  static const int64_t ADAPTIVE_DOP_GROW_INTERVAL = 10 * 1000; // 10ms
+  int check_adaptive_dop(const ObOpSpec &root, int64_t &gi_count, bool &can_adapt) const;
+  int init_adaptive_dop();
+  int dispatch_deferred_task(int64_t task_idx);
+  void skip_deferred_tasks(int skip_ret);
+  void skip_deferred_task(int64_t task_idx, int skip_ret);
+  void start_claimed_tasks(int64_t start_idx, int64_t end_idx, int skip_ret);
   int setup_loop_proc(ObSqcCtx &sqc_ctx) const;
   int setup_op_input(ObExecContext &ctx,
                      ObOpSpec &root,
@@ -104,6 +169,11 @@ private:
   int create_tasks(ObPxRpcInitSqcArgs &sqc_arg, ObSqcCtx &sqc_ctx, bool is_fast_sqc = false);
   int try_cleanup_tasks();
 
+  int init_task_args(ObPxRpcInitSqcArgs &sqc_arg,
+                     ObSqcCtx &sqc_ctx,
+                     int64_t task_idx,
+                     ObPxRpcInitTaskArgs &args,
+                     ObPxTask *&task_ptr);
   int dispatch_task_to_thread_pool(ObPxRpcInitSqcArgs &sqc_arg,
                                    ObSqcCtx &sqc_ctx,
                                    ObPxSqcMeta &sqc,
@@ -135,6 +205,10 @@ private:
   int64_t reserved_thread_count_;
   dtl::ObDtlLocalFirstBufferCache first_buffer_cache_;
   ObPXBloomFilterHashWrapper bf_key_; // for bloom_filter_use op
+  ObPxDeferredTaskSet deferred_tasks_;
+  int64_t adaptive_start_task_count_; // 0 means adaptive dop is off
+  int64_t adaptive_start_ts_;
+  volatile int64_t last_grow_ts_;
   DISALLOW_COPY_AND_ASSIGN(ObPxSubCoord);
 };
 }
@@ -2385,6 +2385,14 @@ int ObPxAffinityByRandom::do_random(bool use_partition_info)
         tablet_hash_values_.at(idx).worker_id_ = worker_id++;
       }
     } else {
+      // 按行数从大到小放置(LPT)，避免大分区最后放置导致某个worker负载过重，
+      // 稳定排序保证行数相同的分区仍保持随机序
+      auto compare_fun_by_row_count = [](const TabletHashValue &a, const TabletHashValue &b) -> bool {
+        return a.partition_info_.physical_row_count_ > b.partition_info_.physical_row_count_;
+      };
+      std::stable_sort(tablet_hash_values_.begin(),
+                       tablet_hash_values_.end(),
+                       compare_fun_by_row_count);
       ARRAY_FOREACH(tablet_hash_values_, idx) {
         int64_t min_load_index = 0;
         int64_t min_load = INT64_MAX;
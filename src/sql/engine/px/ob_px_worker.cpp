@@ -162,42 +162,62 @@ void PxWorkerFunctor::operator ()()
     }
     THIS_WORKER.set_group_id(env_arg_.get_group_id());
     MTL_SWITCH(sqc_handler->get_tenant_id()) {
-      CREATE_WITH_TEMP_ENTITY(RESOURCE_OWNER, sqc_handler->get_tenant_id()) {
-        if (OB_FAIL(ROOT_CONTEXT->CREATE_CONTEXT(mem_context,
-            lib::ContextParam().set_mem_attr(MTL_ID(), ObModIds::OB_SQL_PX)))) {
-          LOG_WARN("create memory entity failed", K(ret));
-        } else {
-          WITH_CONTEXT(mem_context) {
-            lib::ContextTLOptGuard guard(true);
-            // 在worker线程中进行args的deep copy，分担sqc的线程的负担。
-            ObPxRpcInitTaskArgs runtime_arg;
-            if (OB_FAIL(runtime_arg.init_deserialize_param(mem_context, *env_arg_.get_gctx()))) {
-              LOG_WARN("fail to init args", K(ret));
-            } else if (OB_FAIL(runtime_arg.deep_copy_assign(task_arg_, mem_context->get_arena_allocator()))) {
-              (void) ObInterruptUtil::interrupt_qc(task_arg_.task_, ret);
-              LOG_WARN("fail deep copy assign arg", K(task_arg_), K(ret));
-            } else {
-              // 绑定sqc_handler，方便算子任何地方都可以拿sqc_handle
-              runtime_arg.sqc_handler_ = sqc_handler;
+      // 自适应并行下尚未调度的 task 由退出的 worker 在本线程中依次执行，
+      // 此时 granule 已经取完，它们只需关闭各自的 channel
+      bool has_next_task = true;
+      while (has_next_task) {
+        has_next_task = false;
+        CREATE_WITH_TEMP_ENTITY(RESOURCE_OWNER, sqc_handler->get_tenant_id()) {
+          if (OB_FAIL(ROOT_CONTEXT->CREATE_CONTEXT(mem_context,
+              lib::ContextParam().set_mem_attr(MTL_ID(), ObModIds::OB_SQL_PX)))) {
+            LOG_WARN("create memory entity failed", K(ret));
+          } else {
+            WITH_CONTEXT(mem_context) {
+              lib::ContextTLOptGuard guard(true);
+              // 在worker线程中进行args的deep copy，分担sqc的线程的负担。
+              ObPxRpcInitTaskArgs runtime_arg;
+              if (OB_FAIL(runtime_arg.init_deserialize_param(mem_context, *env_arg_.get_gctx()))) {
+                LOG_WARN("fail to init args", K(ret));
+              } else if (OB_FAIL(runtime_arg.deep_copy_assign(task_arg_, mem_context->get_arena_allocator()))) {
+                (void) ObInterruptUtil::interrupt_qc(task_arg_.task_, ret);
+                LOG_WARN("fail deep copy assign arg", K(task_arg_), K(ret));
+              } else {
+                // 绑定sqc_handler，方便算子任何地方都可以拿sqc_handle
+                runtime_arg.sqc_handler_ = sqc_handler;
+              }
+
+              // 执行
+              ObPxTaskProcess worker(*env_arg_.get_gctx(), runtime_arg);
+              worker.set_is_oracle_mode(env_arg_.is_oracle_mode());
+              sqc_handler->get_notifier().worker_start(GETTID());
+              if (OB_SUCC(ret)) {
+                worker.run();
+              }
+              runtime_arg.destroy();
+              // 本 task 失败或被中断时跳过所有尚未调度的 task
+              int end_ret = ret;
+              if (OB_SUCCESS == end_ret && OB_NOT_NULL(task_arg_.sqc_task_ptr_)
+                  && task_arg_.sqc_task_ptr_->has_result()) {
+                end_ret = task_arg_.sqc_task_ptr_->get_result();
+              }
+              if (OB_SUCCESS == end_ret && IS_INTERRUPTED()) {
+                end_ret = GET_INTERRUPT_CODE().code_;
+              }
+              {
+                lib::CompatModeGuard g(env_arg_.is_oracle_mode() ?
+                    lib::Worker::CompatMode::ORACLE : lib::Worker::CompatMode::MYSQL);
+                has_next_task = sqc_handler->get_sub_coord().claim_deferred_task(end_ret, task_arg_);
+              }
+
+              LOG_TRACE("Is finish all worker", K(ret), K(sqc_handler->get_notifier()));
+              sqc_handler->worker_end_hook();
             }
-
-            // 执行
-            ObPxTaskProcess worker(*env_arg_.get_gctx(), runtime_arg);
-            worker.set_is_oracle_mode(env_arg_.is_oracle_mode());
-            sqc_handler->get_notifier().worker_start(GETTID());
-            if (OB_SUCC(ret)) {
-              worker.run();
-            }
-            runtime_arg.destroy();
-
-            LOG_TRACE("Is finish all worker", K(ret), K(sqc_handler->get_notifier()));
-            sqc_handler->worker_end_hook();
           }
         }
-      }
-      if (nullptr != mem_context) {
-        DESTROY_CONTEXT(mem_context);
-        mem_context = NULL;
+        if (nullptr != mem_context) {
+          DESTROY_CONTEXT(mem_context);
+          mem_context = NULL;
+        }
       }
       auto *pm = common::ObPageManager::thread_local_instance();
       if (OB_LIKELY(nullptr != pm)) {
@@ -27,11 +27,30 @@ int ObExecuteResult::open(ObExecContext &ctx)
 {
   int ret = OB_SUCCESS;
   UNUSED(ctx);
-  ret = open();
+  if (rc_ctx_.is_hit()) {
+    // rows are served from the result cache
+  } else {
+    ret = open();
+  }
   return ret;
 }
 
 int ObExecuteResult::get_next_row(ObExecContext &ctx, const common::ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  if (rc_ctx_.is_hit()) {
+    ret = rc_ctx_.get_next_row(ctx.get_allocator(), row);
+  } else if (OB_FAIL(inner_get_next_row(ctx, row))) {
+    if (OB_ITER_END == ret && rc_ctx_.is_building()) {
+      rc_ctx_.finish(ctx);
+    }
+  } else if (rc_ctx_.is_building()) {
+    rc_ctx_.add_row(*row);
+  }
+  return ret;
+}
+
+int ObExecuteResult::inner_get_next_row(ObExecContext &ctx, const common::ObNewRow *&row)
 {
   int ret = OB_SUCCESS;
   row = &row_;
@@ -89,7 +108,10 @@ int ObExecuteResult::close(ObExecContext &ctx)
 {
   int ret = OB_SUCCESS;
   UNUSED(ctx);
-  ret = close();
+  if (!rc_ctx_.is_hit()) {
+    ret = close();
+  }
+  rc_ctx_.reset();
   return ret;
 }
 
@@ -16,6 +16,7 @@
 #include "common/row/ob_row.h"
 #include "share/ob_scanner.h"
 #include "sql/engine/ob_operator.h"
+#include "sql/plan_cache/ob_result_cache.h"
 
 namespace oceanbase
 {
@@ -51,6 +52,9 @@ public:
   virtual int close(ObExecContext &ctx) override;
 
   inline int get_err_code() { return err_code_; }
+  // look up the result cache before the statement starts
+  int prepare_result_cache(ObExecContext &ctx, const ObPhysicalPlan &plan)
+  { return rc_ctx_.prepare(ctx, plan); }
 
   // interface for static typing engine
   int open() const;
@@ -63,12 +67,15 @@ public:
     br_it_.set_operator(op);
   }
 
+private:
+  int inner_get_next_row(ObExecContext &ctx, const common::ObNewRow *&row);
 private:
   int err_code_;
   ObOperator *static_engine_root_;
   // row used to adapt old get_next_row interface.
   mutable common::ObNewRow row_;
   mutable ObBatchRowIter br_it_;
+  ObResultCacheCtx rc_ctx_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExecuteResult);
 };
@@ -1301,6 +1301,77 @@ int ObNullAwareHashSliceIdCalc::get_slice_indexes(const ObIArray<ObExpr*> &exprs
   return ret;
 }
 
+int ObHybridHashSliceIdCalcBase::check_popular(ObEvalCtx &eval_ctx, bool &is_popular)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *datum = NULL;
+  is_popular = false;
+  if (OB_ISNULL(hash_dist_exprs_) || OB_ISNULL(hash_funcs_) || OB_ISNULL(popular_hash_vals_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("hash func, expr or popular values not init", K(ret));
+  } else if (popular_hash_vals_->empty()) {
+    // do nothing
+  } else if (OB_UNLIKELY(1 != n_keys_ || 1 != hash_dist_exprs_->count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("hybrid hash distribution can only process 1 join key now", K(ret), K(n_keys_));
+  } else if (OB_FAIL(hash_dist_exprs_->at(0)->eval(eval_ctx, datum))) {
+    LOG_WARN("failed to eval datum", K(ret));
+  } else if (!datum->is_null()) {
+    // popular values are never null, null rows are handled by %null_row_dist_method_
+    const uint64_t hash_val = hash_funcs_->at(0).hash_func_(*datum, SLICE_CALC_HASH_SEED);
+    for (int64_t i = 0; !is_popular && i < popular_hash_vals_->count(); ++i) {
+      is_popular = (hash_val == popular_hash_vals_->at(i));
+    }
+  }
+  return ret;
+}
+
+int ObHybridHashBroadcastSliceIdCalc::get_slice_indexes(const ObIArray<ObExpr*> &exprs,
+                                                        ObEvalCtx &eval_ctx,
+                                                        SliceIdxArray &slice_idx_array)
+{
+  int ret = OB_SUCCESS;
+  UNUSED(exprs);
+  bool is_popular = false;
+  int64_t slice_idx = 0;
+  slice_idx_array.reuse();
+  if (OB_FAIL(check_popular(eval_ctx, is_popular))) {
+    LOG_WARN("failed to check popular value", K(ret));
+  } else if (is_popular) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < task_cnt_; ++i) {
+      if (OB_FAIL(slice_idx_array.push_back(i))) {
+        LOG_WARN("failed to push back i", K(ret));
+      }
+    }
+  } else if (OB_FAIL(calc_slice_idx(eval_ctx, task_cnt_, slice_idx))) {
+    LOG_WARN("failed to calc slice idx", K(ret));
+  } else if (OB_FAIL(slice_idx_array.push_back(slice_idx))) {
+    LOG_WARN("failed to push back slice idx", K(ret));
+  }
+  return ret;
+}
+
+int ObHybridHashRandomSliceIdCalc::get_slice_idx(const ObIArray<ObExpr*> &exprs,
+                                                 ObEvalCtx &eval_ctx,
+                                                 int64_t &slice_idx)
+{
+  int ret = OB_SUCCESS;
+  UNUSED(exprs);
+  bool is_popular = false;
+  if (OB_UNLIKELY(task_cnt_ <= 0)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid task count", K(ret), K(task_cnt_));
+  } else if (OB_FAIL(check_popular(eval_ctx, is_popular))) {
+    LOG_WARN("failed to check popular value", K(ret));
+  } else if (is_popular) {
+    slice_idx = round_robin_idx_ % task_cnt_;
+    round_robin_idx_++;
+  } else if (OB_FAIL(calc_slice_idx(eval_ctx, task_cnt_, slice_idx))) {
+    LOG_WARN("failed to calc slice idx", K(ret));
+  }
+  return ret;
+}
+
 int ObNullAwareAffinitizedRepartSliceIdxCalc::init()
 {
   int ret = OB_SUCCESS;
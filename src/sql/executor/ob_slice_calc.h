@@ -892,6 +892,71 @@ public:
     const ObIArray<ObExpr*> &exprs, ObEvalCtx &eval_ctx, SliceIdxArray &slice_idx_array);
 };
 
+// Skew aware hash distribution of hash join (single join key only).
+// Both sides of the join share the hash values of the popular join key values,
+// rows with popular value are broadcast on build side and sent round robin on probe side,
+// other rows are hash distributed as ObHashSliceIdCalc does.
+// Hash conflicts of normal values with popular values are harmless, those rows are handled
+// the same way on both sides.
+class ObHybridHashSliceIdCalcBase : public ObHashSliceIdCalc
+{
+public:
+  ObHybridHashSliceIdCalcBase(ObIAllocator &alloc,
+                              const int64_t task_cnt,
+                              ObNullDistributeMethod::Type null_row_dist_method,
+                              const ObIArray<ObExpr*> *dist_exprs,
+                              const ObIArray<ObHashFunc> *hash_funcs,
+                              const ObIArray<uint64_t> *popular_hash_vals)
+      : ObSliceIdxCalc(alloc, null_row_dist_method),
+        ObHashSliceIdCalc(alloc, task_cnt, null_row_dist_method, dist_exprs, hash_funcs),
+        popular_hash_vals_(popular_hash_vals)
+  {
+    support_vectorized_calc_ = false;
+  }
+protected:
+  int check_popular(ObEvalCtx &eval_ctx, bool &is_popular);
+  const ObIArray<uint64_t> *popular_hash_vals_;
+};
+
+// build side of hybrid hash distribution: broadcast rows with popular value
+class ObHybridHashBroadcastSliceIdCalc : public ObHybridHashSliceIdCalcBase
+{
+public:
+  ObHybridHashBroadcastSliceIdCalc(ObIAllocator &alloc,
+                                   const int64_t task_cnt,
+                                   ObNullDistributeMethod::Type null_row_dist_method,
+                                   const ObIArray<ObExpr*> *dist_exprs,
+                                   const ObIArray<ObHashFunc> *hash_funcs,
+                                   const ObIArray<uint64_t> *popular_hash_vals)
+      : ObSliceIdxCalc(alloc, null_row_dist_method),
+        ObHybridHashSliceIdCalcBase(alloc, task_cnt, null_row_dist_method, dist_exprs,
+                                    hash_funcs, popular_hash_vals)
+  {}
+
+  virtual int get_slice_indexes(
+    const ObIArray<ObExpr*> &exprs, ObEvalCtx &eval_ctx, SliceIdxArray &slice_idx_array) override;
+};
+
+// probe side of hybrid hash distribution: send rows with popular value round robin
+class ObHybridHashRandomSliceIdCalc : public ObHybridHashSliceIdCalcBase
+{
+public:
+  ObHybridHashRandomSliceIdCalc(ObIAllocator &alloc,
+                                const int64_t task_cnt,
+                                ObNullDistributeMethod::Type null_row_dist_method,
+                                const ObIArray<ObExpr*> *dist_exprs,
+                                const ObIArray<ObHashFunc> *hash_funcs,
+                                const ObIArray<uint64_t> *popular_hash_vals)
+      : ObSliceIdxCalc(alloc, null_row_dist_method),
+        ObHybridHashSliceIdCalcBase(alloc, task_cnt, null_row_dist_method, dist_exprs,
+                                    hash_funcs, popular_hash_vals)
+  {}
+
+  virtual int get_slice_idx(const ObIArray<ObExpr*> &exprs,
+                            ObEvalCtx &eval_ctx,
+                            int64_t &slice_idx) override;
+};
+
 
 class ObNullAwareAffinitizedRepartSliceIdxCalc : public ObAffinitizedRepartSliceIdxCalc
 {
@@ -454,6 +454,16 @@ OB_INLINE int ObResultSet::do_open_plan(ObExecContext &ctx)
     }
   }
 
+  if (OB_SUCC(ret) && physical_plan_->enable_result_cache()) {
+    // capture the data versions before the snapshot of the statement is taken,
+    // failures only disable the result cache of this execution
+    int tmp_ret = OB_SUCCESS;
+    if (OB_TMP_FAIL(ctx.get_task_exec_ctx().get_execute_result()
+                    .prepare_result_cache(ctx, *physical_plan_))) {
+      LOG_WARN("fail to prepare result cache", K(tmp_ret));
+    }
+  }
+
   if (OB_FAIL(ret)) {
   } else if (OB_FAIL(start_stmt())) {
     LOG_WARN("fail start stmt", K(ret));
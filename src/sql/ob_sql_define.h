@@ -352,6 +352,10 @@ struct ObPQDistributeMethod
     DEF(PARTITION_RANDOM,) \
     DEF(RANGE,)\
     DEF(PARTITION_RANGE,)\
+    /* skew aware hash distribution for hash join, rows of popular values are */ \
+    /* BROADCAST on build side and RANDOM on probe side, others are HASH */ \
+    DEF(HYBRID_HASH_BROADCAST,)\
+    DEF(HYBRID_HASH_RANDOM,)\
     DEF(LOCAL,) // represents pull to local
 
 DECLARE_ENUM(Type, type, PQ_DIST_METHOD_DEF, static);
@@ -462,6 +466,13 @@ enum class ObParamOption {
   MAX_VALUE
 };
 
+enum class ObResultCacheOption {
+  NOT_SPECIFIED = -1,
+  ENABLE,
+  DISABLE,
+  MAX_VALUE
+};
+
 struct ObSqlArrayObj
 {
   ObSqlArrayObj()
@@ -29,6 +29,7 @@
 #include "sql/optimizer/ob_log_temp_table_insert.h"
 #include "sql/optimizer/ob_opt_selectivity.h"
 #include "share/stat/ob_opt_stat_manager.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 using namespace oceanbase;
 using namespace sql;
 using namespace oceanbase::common;
@@ -4440,6 +4441,8 @@ int JoinPath::assign(const JoinPath &other, common::ObIAllocator *allocator)
     LOG_WARN("failed to assign array", K(ret));
   } else if (OB_FAIL(join_filter_infos_.assign(other.join_filter_infos_))) {
     LOG_WARN("failed to assign array", K(ret));
+  } else if (OB_FAIL(popular_values_.assign(other.popular_values_))) {
+    LOG_WARN("failed to assign array", K(ret));
   }
   return ret;
 }
@@ -4778,7 +4781,13 @@ int JoinPath::compute_hash_hash_sharding_info()
         }
       }
     }
-    if (OB_SUCC(ret)) {
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(compute_hybrid_hash_info(left_join_exprs, right_join_exprs))) {
+      LOG_WARN("failed to compute hybrid hash info", K(ret));
+    } else if (!popular_values_.empty()) {
+      // rows of popular values are not hash distributed by the join keys
+      strong_sharding_ = log_plan->get_optimizer_context().get_distributed_sharding();
+    } else {
       if ((use_left && FULL_OUTER_JOIN != join_type_ && RIGHT_OUTER_JOIN != join_type_) ||
           (use_right && FULL_OUTER_JOIN != join_type_ && LEFT_OUTER_JOIN != join_type_)) {
         ObShardingInfo *target_sharding = NULL;
@@ -4822,6 +4831,54 @@ int JoinPath::compute_hash_hash_sharding_info()
   return ret;
 }
 
+// Skew handling of hash-hash distributed hash join.
+// Popular values of the probe side join key are found from its histogram. Probe rows with
+// popular value are sent to random workers and the matched build rows are broadcast,
+// other rows are still hash distributed. Only inner join is supported, broadcast build
+// rows must not produce unmatched output.
+int JoinPath::compute_hybrid_hash_info(const ObIArray<ObRawExpr*> &left_join_exprs,
+                                       const ObIArray<ObRawExpr*> &right_join_exprs)
+{
+  int ret = OB_SUCCESS;
+  bool enable_skew_handling = false;
+  ObLogPlan *log_plan = NULL;
+  ObSQLSessionInfo *session_info = NULL;
+  const ObRawExpr *left_key = NULL;
+  const ObRawExpr *right_key = NULL;
+  popular_values_.reuse();
+  if (OB_ISNULL(parent_) || OB_ISNULL(log_plan = parent_->get_plan()) ||
+      OB_ISNULL(session_info = log_plan->get_optimizer_context().get_session_info())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(parent_), K(log_plan), K(ret));
+  } else if (DistAlgo::DIST_HASH_HASH != join_dist_algo_ || is_slave_mapping_ ||
+             JoinAlgo::HASH_JOIN != join_algo_ || INNER_JOIN != join_type_ ||
+             1 != left_join_exprs.count() || 1 != right_join_exprs.count()) {
+    // only inner hash join with single join key is supported
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session_info->get_effective_tenant_id()));
+    enable_skew_handling = tenant_config.is_valid() && tenant_config->_px_join_skew_handling;
+  }
+  if (OB_FAIL(ret) || !enable_skew_handling) {
+    // do nothing
+  } else if (OB_ISNULL(left_key = left_join_exprs.at(0)) ||
+             OB_ISNULL(right_key = right_join_exprs.at(0))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(left_key), K(right_key), K(ret));
+  } else if (!left_key->is_column_ref_expr() || !right_key->is_column_ref_expr()) {
+    // popular values are only available from column histogram
+  } else if (left_key->get_result_type().get_type() != right_key->get_result_type().get_type() ||
+             left_key->get_result_type().get_collation_type() !=
+             right_key->get_result_type().get_collation_type()) {
+    // both sides must compute the same hash value for popular values
+  } else if (OB_FAIL(log_plan->get_popular_values(*static_cast<const ObColumnRefRawExpr*>(right_key),
+                                                  popular_values_))) {
+    LOG_WARN("failed to get popular values", K(ret));
+  } else if (!popular_values_.empty()) {
+    LOG_TRACE("use hybrid hash distribution for skewed join key", K(popular_values_));
+  }
+  return ret;
+}
+
 int JoinPath::compute_join_path_parallel_and_server_info()
 {
   int ret = OB_SUCCESS;
@@ -5685,6 +5742,7 @@ void JoinPath::reuse()
   contain_normal_nl_ = false;
   is_naaj_ = false;
   is_sna_ = false;
+  popular_values_.reuse();
 }
 
 int JoinPath::compute_pipeline_info()
@@ -8185,7 +8243,8 @@ int ObJoinOrder::generate_join_filter_infos(const Path *left_path,
   if (OB_ISNULL(left_path) || OB_ISNULL(right_path) || OB_ISNULL(get_plan())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("param has null", K(ret), K(left_path), K(right_path), K(get_plan()));
-  } else if (get_plan()->get_optimizer_context().get_parallel() <= 1) {
+  } else if (get_plan()->get_optimizer_context().get_parallel() <= 1 &&
+             !get_plan()->get_optimizer_context().enable_serial_join_filter()) {
     //do nothing
   } else if (RIGHT_OUTER_JOIN == join_type ||
             FULL_OUTER_JOIN == join_type ||
@@ -8417,6 +8476,11 @@ int ObJoinOrder::check_normal_join_filter_valid(const Path& left_path,
       info.can_use_join_filter_ = false;
     } else if (!info.can_use_join_filter_ || info.lexprs_.empty()) {
       info.can_use_join_filter_ = false;
+    } else if (plan->get_optimizer_context().get_parallel() <= 1 &&
+               NULL == info.force_filter_ &&
+               left_path.get_path_output_rows() > SERIAL_JOIN_FILTER_BUILD_ROW_COUNT_THRESHOLD) {
+      // serial join filter is built by one thread, only for small build side
+      info.can_use_join_filter_ = false;
     } else if (OB_FAIL(calc_join_filter_selectivity(left_path,
                                                     right_path,
                                                     info,
@@ -8528,6 +8592,9 @@ int ObJoinOrder::check_partition_join_filter_valid(const DistAlgo join_dist_algo
     match = false;
     if (!info.need_partition_join_filter_ || DIST_PARTITION_WISE == join_dist_algo) {
       info.need_partition_join_filter_ = false;
+    } else if (plan->get_optimizer_context().get_parallel() <= 1) {
+      // partition join filter is used by granule iterator, which is absent in serial plan
+      info.need_partition_join_filter_ = false;
     } else if (OB_ISNULL(info.sharding_)) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("unexpected null sharding", K(ret));
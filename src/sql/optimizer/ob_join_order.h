@@ -659,7 +659,8 @@ struct EstimateCostInfo {
       contain_normal_nl_(false),
       can_use_batch_nlj_(false),
       is_naaj_(false),
-      is_sna_(false)
+      is_sna_(false),
+      popular_values_()
     {
     }
 
@@ -695,7 +696,8 @@ struct EstimateCostInfo {
         contain_normal_nl_(false),
         can_use_batch_nlj_(false),
         is_naaj_(false),
-        is_sna_(false)
+        is_sna_(false),
+        popular_values_()
       {
       }
     virtual ~JoinPath() {}
@@ -840,6 +842,8 @@ struct EstimateCostInfo {
     }
   private:
     int compute_hash_hash_sharding_info();
+    int compute_hybrid_hash_info(const ObIArray<ObRawExpr*> &left_join_exprs,
+                                 const ObIArray<ObRawExpr*> &right_join_exprs);
     int compute_join_path_ordering();
     int compute_join_path_info();
     int compute_join_path_sharding();
@@ -870,7 +874,8 @@ struct EstimateCostInfo {
                  K_(contain_normal_nl),
                  K_(can_use_batch_nlj),
                  K_(is_naaj),
-                 K_(is_sna));
+                 K_(is_sna),
+                 K_(popular_values));
   public:
     const Path *left_path_;
     const Path *right_path_;
@@ -901,6 +906,8 @@ struct EstimateCostInfo {
     bool can_use_batch_nlj_;
     bool is_naaj_; // is null aware anti join
     bool is_sna_; // is single null aware anti join
+    // popular values of the probe side join key, hybrid hash distribution is used if not empty
+    common::ObSEArray<common::ObObj, 4, common::ModulePageAllocator, true> popular_values_;
   private:
       DISALLOW_COPY_AND_ASSIGN(JoinPath);
   };
@@ -1064,6 +1071,7 @@ struct NullAwareAntiJoinInfo {
     // used for heuristic index selection
     static const int64_t TABLE_HEURISTIC_UNIQUE_KEY_RANGE_THRESHOLD = 10000;
     static const int64_t PRUNING_ROW_COUNT_THRESHOLD = 1000;
+    static const int64_t SERIAL_JOIN_FILTER_BUILD_ROW_COUNT_THRESHOLD = 1000000;
 
     struct PathHelper {
       PathHelper()
@@ -263,7 +263,7 @@ int ObLogExchange::print_plan_head_annotation(char* buf,
         print_annotation_keys(exprs);
       }
     }
-    if (OB_SUCC(ret) && is_pq_hash_dist()) {
+    if (OB_SUCC(ret) && (is_pq_hash_dist() || is_pq_hybrid_hash())) {
       ObSEArray<ObRawExpr *, 16> exprs;
       FOREACH_CNT_X(e, hash_dist_exprs_, OB_SUCC(ret)) {
         OZ(exprs.push_back(e->expr_));
@@ -305,6 +305,9 @@ int ObLogExchange::print_my_plan_annotation(char *buf,
         OB_PHY_PLAN_REMOTE != get_plan()->get_optimizer_context().get_phy_plan_type()) {
       ret = BUF_PRINTF(", dop=%d", parallel);
     }
+    if (OB_SUCC(ret) && is_pq_hybrid_hash()) {
+      ret = BUF_PRINTF(", popular_values=%ld", popular_values_.count());
+    }
   } else {
     if (is_task_order_) {
       ret = BUF_PRINTF(", task_order");
@@ -534,6 +537,9 @@ int ObLogExchange::set_exchange_info(const ObExchangeInfo &exch_info)
                 dist_method_ == ObPQDistributeMethod::PARTITION_RANGE) &&
                 OB_FAIL(sort_keys_.assign(exch_info.sort_keys_))) {
       LOG_WARN("failed to assign sort keys", K(ret));
+    } else if (is_pq_hybrid_hash() &&
+               OB_FAIL(popular_values_.assign(exch_info.popular_values_))) {
+      LOG_WARN("failed to assign popular values", K(ret));
     } else {
       is_rollup_hybrid_ = exch_info.is_rollup_hybrid_;
       need_null_aware_shuffle_ = exch_info.need_null_aware_shuffle_;
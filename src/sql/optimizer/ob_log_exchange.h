@@ -56,7 +56,8 @@ public:
       random_expr_(NULL),
       need_null_aware_shuffle_(false),
       is_old_unblock_mode_(true),
-      sample_type_(NOT_INIT_SAMPLE_TYPE)
+      sample_type_(NOT_INIT_SAMPLE_TYPE),
+      popular_values_()
   {
     repartition_table_id_ = 0;
   }
@@ -109,6 +110,12 @@ public:
   bool is_pq_pkey_rand() const { return dist_method_ == ObPQDistributeMethod::PARTITION_RANDOM; }
   bool is_pq_pkey_range() const { return dist_method_ == ObPQDistributeMethod::PARTITION_RANGE;}
   bool is_pq_range() const { return dist_method_ == ObPQDistributeMethod::RANGE; }
+  bool is_pq_hybrid_hash() const
+  {
+    return dist_method_ == ObPQDistributeMethod::HYBRID_HASH_BROADCAST
+           || dist_method_ == ObPQDistributeMethod::HYBRID_HASH_RANDOM;
+  }
+  const common::ObIArray<common::ObObj> &get_popular_values() const { return popular_values_; }
   ObPQDistributeMethod::Type get_dist_method() const { return dist_method_; }
   ObPQDistributeMethod::Type get_unmatch_row_dist_method() const { return unmatch_row_dist_method_; }
   ObNullDistributeMethod::Type get_null_row_dist_method() const { return null_row_dist_method_; }
@@ -237,6 +244,8 @@ private:
   // -for pkey range/range
   ObPxSampleType sample_type_;
   // -end pkey range/range
+  // popular values of join key for hybrid hash distribution
+  common::ObSEArray<common::ObObj, 4, common::ModulePageAllocator, true> popular_values_;
   DISALLOW_COPY_AND_ASSIGN(ObLogExchange);
 };
 } // end of namespace sql
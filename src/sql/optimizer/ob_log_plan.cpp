@@ -60,6 +60,8 @@
 #include "sql/optimizer/ob_log_delete.h"
 #include "sql/optimizer/ob_log_del_upd.h"
 #include "sql/optimizer/ob_log_stat_collector.h"
+#include "share/stat/ob_opt_stat_manager.h"
+#include "share/stat/ob_opt_column_stat_cache.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "sql/optimizer/ob_update_log_plan.h"
 #include "sql/resolver/dml/ob_sql_hint.h"
@@ -4694,6 +4696,10 @@ int ObLogPlan::compute_join_exchange_info(JoinPath &join_path,
                                                left_exch_info,
                                                right_exch_info))) {
       LOG_WARN("failed to compute hash distribution info", K(ret));
+    } else if (OB_FAIL(compute_hybrid_hash_distribution_info(join_path,
+                                                             left_exch_info,
+                                                             right_exch_info))) {
+      LOG_WARN("failed to compute hybrid hash distribution info", K(ret));
     } else { /* do nothing*/ }
   } else if (DistAlgo::DIST_PULL_TO_LOCAL == join_path.join_dist_algo_) {
     if (join_path.left_path_->is_sharding() && !join_path.left_path_->contain_fake_cte()) {
@@ -4860,6 +4866,82 @@ int ObLogPlan::compute_hash_distribution_info(const ObIArray<ObRawExpr*> &join_e
   return ret;
 }
 
+// The popular values of the probe side join key are decided by the join path,
+// see JoinPath::compute_hybrid_hash_info.
+int ObLogPlan::compute_hybrid_hash_distribution_info(const JoinPath &join_path,
+                                                     ObExchangeInfo &left_exch_info,
+                                                     ObExchangeInfo &right_exch_info)
+{
+  int ret = OB_SUCCESS;
+  if (join_path.popular_values_.empty()) {
+    // do nothing
+  } else if (OB_UNLIKELY(1 != left_exch_info.hash_dist_exprs_.count() ||
+                         1 != right_exch_info.hash_dist_exprs_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected hash dist exprs for hybrid hash", K(left_exch_info),
+             K(right_exch_info), K(ret));
+  } else if (OB_FAIL(left_exch_info.popular_values_.assign(join_path.popular_values_))) {
+    LOG_WARN("failed to assign popular values", K(ret));
+  } else if (OB_FAIL(right_exch_info.popular_values_.assign(join_path.popular_values_))) {
+    LOG_WARN("failed to assign popular values", K(ret));
+  } else {
+    left_exch_info.dist_method_ = ObPQDistributeMethod::HYBRID_HASH_BROADCAST;
+    right_exch_info.dist_method_ = ObPQDistributeMethod::HYBRID_HASH_RANDOM;
+  }
+  return ret;
+}
+
+// A value is popular if its frequency in the histogram reaches _px_join_skew_minfreq percent.
+// Long strings are truncated in the histogram and never match the hash value of real data,
+// which is harmless and only loses the skew handling of such values.
+int ObLogPlan::get_popular_values(const ObColumnRefRawExpr &col_expr,
+                                  ObIArray<ObObj> &popular_values)
+{
+  int ret = OB_SUCCESS;
+  int64_t min_freq = 0;
+  ObOptColumnStatHandle handler;
+  ObSQLSessionInfo *session_info = get_optimizer_context().get_session_info();
+  popular_values.reuse();
+  if (OB_ISNULL(session_info)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret));
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session_info->get_effective_tenant_id()));
+    if (tenant_config.is_valid()) {
+      min_freq = tenant_config->_px_join_skew_minfreq;
+    }
+  }
+  if (OB_FAIL(ret) || min_freq <= 0) {
+    // do nothing
+  } else if (OB_FAIL(ObOptSelectivity::get_histogram_by_column(get_basic_table_metas(),
+                                                               get_selectivity_ctx(),
+                                                               col_expr.get_table_id(),
+                                                               col_expr.get_column_id(),
+                                                               handler))) {
+    LOG_WARN("failed to get histogram by column", K(ret));
+  } else if (NULL == handler.stat_ || !handler.stat_->get_histogram().is_valid() ||
+             handler.stat_->get_histogram().get_sample_size() <= 0) {
+    // do nothing
+  } else {
+    const ObHistogram &hist = handler.stat_->get_histogram();
+    for (int64_t i = 0; OB_SUCC(ret) && i < hist.get_bucket_size(); ++i) {
+      const ObHistBucket &bucket = hist.get(i);
+      ObObj value;
+      if (bucket.endpoint_repeat_count_ * 100 < min_freq * hist.get_sample_size()) {
+        // not popular
+      } else if (bucket.endpoint_value_.is_null() ||
+                 bucket.endpoint_value_.get_type() != col_expr.get_result_type().get_type()) {
+        // do nothing
+      } else if (OB_FAIL(ob_write_obj(get_allocator(), bucket.endpoint_value_, value))) {
+        LOG_WARN("failed to write obj", K(ret));
+      } else if (OB_FAIL(popular_values.push_back(value))) {
+        LOG_WARN("failed to push back popular value", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObLogPlan::compute_repartition_distribution_info(const EqualSets &equal_sets,
                                                      const ObIArray<ObRawExpr*> &src_keys,
                                                      const ObIArray<ObRawExpr*> &target_keys,
@@ -677,6 +677,13 @@ public:
                                      ObExchangeInfo &left_exch_info,
                                      ObExchangeInfo &right_exch_info);
 
+  int compute_hybrid_hash_distribution_info(const JoinPath &join_path,
+                                            ObExchangeInfo &left_exch_info,
+                                            ObExchangeInfo &right_exch_info);
+
+  int get_popular_values(const ObColumnRefRawExpr &col_expr,
+                         ObIArray<ObObj> &popular_values);
+
   void compute_null_distribution_info(const ObJoinType &join_type,
                                       ObExchangeInfo &left_exch_info,
                                       ObExchangeInfo &right_exch_info,
@@ -174,6 +174,8 @@ int ObExchangeInfo::assign(ObExchangeInfo &other)
     LOG_WARN("failed to assign weak sharding", K(ret));
   } else if (OB_FAIL(repart_all_tablet_ids_.assign(other.repart_all_tablet_ids_))) {
     LOG_WARN("failed to assign partition ids", K(ret));
+  } else if (OB_FAIL(popular_values_.assign(other.popular_values_))) {
+    LOG_WARN("failed to assign popular values", K(ret));
   } else {
     is_remote_ = other.is_remote_;
     is_task_order_ = other.is_task_order_;
@@ -5173,7 +5175,9 @@ int ObLogicalOperator::allocate_normal_join_filter(const ObIArray<JoinFilterInfo
               LOG_WARN("failed to mark bloom filter id to receive op", K(filter_id), K(join_filter_use));
             }
           }
-          if ((is_partition_wise_ && !right_has_exchange) || DIST_PARTITION_NONE == join_dist_algo) {
+          if ((is_partition_wise_ && !right_has_exchange) || DIST_PARTITION_NONE == join_dist_algo
+              || get_plan()->get_optimizer_context().get_parallel() <= 1) {
+            // serial plan builds and uses the filter in the same thread
             join_filter_create->set_is_non_shared_join_filter();
             join_filter_use->set_is_non_shared_join_filter();
           } else {
@@ -482,7 +482,8 @@ struct ObExchangeInfo
     need_null_aware_shuffle_(false),
     is_rollup_hybrid_(false),
     may_add_interval_part_(MayAddIntervalPart::NO),
-    sample_type_(NOT_INIT_SAMPLE_TYPE)
+    sample_type_(NOT_INIT_SAMPLE_TYPE),
+    popular_values_()
   {
     repartition_table_id_ = 0;
   }
@@ -536,6 +537,8 @@ struct ObExchangeInfo
   MayAddIntervalPart may_add_interval_part_;
   // sample type for range distribution or partition range distribution
   ObPxSampleType sample_type_;
+  // popular values of join key for hybrid hash distribution
+  common::ObSEArray<common::ObObj, 4> popular_values_;
 
   TO_STRING_KV(K_(is_remote),
                K_(is_task_order),
@@ -557,7 +560,8 @@ struct ObExchangeInfo
                K_(need_null_aware_shuffle),
                K_(is_rollup_hybrid),
                K_(may_add_interval_part),
-               K_(sample_type));
+               K_(sample_type),
+               K_(popular_values));
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExchangeInfo);
 };
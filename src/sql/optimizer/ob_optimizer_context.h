@@ -125,6 +125,7 @@ ObOptimizerContext(ObSQLSessionInfo *session_info,
     batch_size_(0),
     root_stmt_(root_stmt),
     enable_px_batch_rescan_(-1),
+    enable_serial_join_filter_(-1),
     column_usage_infos_(),
     temp_table_infos_(),
     exchange_allocated_(false),
@@ -284,6 +285,22 @@ ObOptimizerContext(ObSQLSessionInfo *session_info,
     return enable_px_batch_rescan_;
   }
 
+  bool enable_serial_join_filter()
+  {
+    if (-1 == enable_serial_join_filter_) {
+      omt::ObTenantConfigGuard tenant_config(
+            TENANT_CONF(session_info_->get_effective_tenant_id()));
+      if (OB_UNLIKELY(!tenant_config.is_valid())) {
+        enable_serial_join_filter_ = 0;
+      } else if (tenant_config->_enable_serial_join_filter) {
+        enable_serial_join_filter_ = 1;
+      } else {
+        enable_serial_join_filter_ = 0;
+      }
+    }
+    return 1 == enable_serial_join_filter_;
+  }
+
   int get_px_object_sample_rate()
   {
     if (-1 == px_object_sample_rate_) {
@@ -500,6 +517,7 @@ private:
   int64_t batch_size_;
   ObDMLStmt *root_stmt_;
   int enable_px_batch_rescan_;
+  int enable_serial_join_filter_; // join filter for hash join in serial plan
   common::ObSEArray<ColumnUsageArg, 16, common::ModulePageAllocator, true> column_usage_infos_;
   common::ObSEArray<ObSqlTempTableInfo*, 1, common::ModulePageAllocator, true> temp_table_infos_;
   bool exchange_allocated_;
@@ -5154,6 +5154,8 @@ int ObSelectLogPlan::adjust_late_materialization_plan_structure(ObLogicalOperato
         LOG_WARN("failed to set filters", K(ret));
       } else if (OB_FAIL(log_join->set_nl_params(scan_params))) {
         LOG_WARN("failed to set nl params", K(ret));
+      } else if (OB_FAIL(check_late_materialization_use_batch(table_scan, log_join))) {
+        LOG_WARN("failed to check late materialization use batch", K(ret));
       } else {
         // set index scan need late materialization, used to print outline.
         index_scan->set_late_materialization(true);
@@ -5163,6 +5165,32 @@ int ObSelectLogPlan::adjust_late_materialization_plan_structure(ObLogicalOperato
   return ret;
 }
 
+// 回表的 table get 按主键等值访问, 与普通 NLJ 的右表一样可以走 group rescan,
+// 把左侧存活下来的 rowkey 攒批后一次性下发给 DAS, 避免逐行 rescan.
+int ObSelectLogPlan::check_late_materialization_use_batch(ObLogTableScan *table_scan,
+                                                          ObLogJoin *join)
+{
+  int ret = OB_SUCCESS;
+  const ObSelectStmt *stmt = NULL;
+  ObSQLSessionInfo *session_info = NULL;
+  bool enable_use_batch_nlj = false;
+  if (OB_ISNULL(table_scan) || OB_ISNULL(join) || OB_ISNULL(stmt = get_stmt()) ||
+      OB_ISNULL(session_info = optimizer_context_.get_session_info())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(table_scan), K(join), K(stmt), K(session_info), K(ret));
+  } else if (OB_FAIL(session_info->get_nlj_batching_enabled(enable_use_batch_nlj))) {
+    LOG_WARN("failed to get nlj batching enabled", K(ret));
+  } else {
+    join->set_can_use_batch_nlj(enable_use_batch_nlj
+                                && !stmt->has_for_update()
+                                && !is_virtual_table(table_scan->get_ref_table_id()));
+    if (OB_FAIL(join->set_use_batch(table_scan))) {
+      LOG_WARN("failed to set use batch nlj", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObSelectLogPlan::generate_late_materialization_info(ObSelectStmt *stmt,
                                                         ObLogTableScan *index_scan,
                                                         ObLogTableScan *&table_get,
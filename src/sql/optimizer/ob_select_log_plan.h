@@ -570,6 +570,9 @@ private:
                                                  ObLogTableScan *index_scan,
                                                  ObLogTableScan *table_scan);
 
+  int check_late_materialization_use_batch(ObLogTableScan *table_scan,
+                                           ObLogJoin *join);
+
   int generate_late_materialization_info(ObSelectStmt *stmt,
                                          ObLogTableScan *index_scan,
                                          ObLogTableScan *&table_get,
@@ -383,6 +383,7 @@ void ObPlanCache::destroy()
     if (OB_SUCCESS != (cache_evict_all_obj())) {
       SQL_PC_LOG(WARN, "fail to evict all lib cache cache");
     }
+    result_cache_.destroy();
     inited_ = false;
   }
 }
@@ -400,6 +401,8 @@ int ObPlanCache::init(int64_t hash_bucket, common::ObAddr addr,
                                                   ObModIds::OB_HASH_NODE_PLAN_CACHE,
                                                   tenant_id))) {
       SQL_PC_LOG(WARN, "failed to init PlanCache", K(ret));
+    } else if (OB_FAIL(result_cache_.init(tenant_id))) {
+      SQL_PC_LOG(WARN, "failed to init result cache", K(ret));
     } else {
       cn_factory_.set_lib_cache(this);
       ObMemAttr attr = get_mem_attr();
@@ -1128,6 +1131,8 @@ int ObPlanCache::cache_evict_all_plan()
   int ret = OB_SUCCESS;
   if (OB_FAIL(cache_evict_by_ns(ObLibCacheNameSpace::NS_CRSR))) {
     SQL_PC_LOG(WARN, "failed to foreach cache evict", K(ret));
+  } else if (OB_FAIL(result_cache_.evict_all())) {
+    SQL_PC_LOG(WARN, "failed to evict all results", K(ret));
   }
   return ret;
 }
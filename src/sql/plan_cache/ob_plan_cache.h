@@ -24,6 +24,7 @@
 #include "sql/plan_cache/ob_lib_cache_key_creator.h"
 #include "sql/plan_cache/ob_lib_cache_node_factory.h"
 #include "sql/plan_cache/ob_lib_cache_object_manager.h"
+#include "sql/plan_cache/ob_result_cache.h"
 
 namespace oceanbase
 {
@@ -295,6 +296,7 @@ public:
   int remove_cache_obj_stat_entry(const ObCacheObjID cache_obj_id);
   ObLCObjectManager &get_cache_obj_mgr() { return co_mgr_; }
   ObLCNodeFactory &get_cache_node_factory() { return cn_factory_; }
+  ObResultCache &get_result_cache() { return result_cache_; }
   int alloc_cache_obj(ObCacheObjGuard& guard, ObLibCacheNameSpace ns, uint64_t tenant_id);
   void free_cache_obj(ObILibCacheObject *&cache_obj, const CacheRefHandleID ref_handle);
   int destroy_cache_obj(const bool is_leaked, const uint64_t object_id);
@@ -385,6 +387,7 @@ private:
   ObLCObjectManager co_mgr_;
   ObLCNodeFactory cn_factory_;
   CacheKeyNodeMap cache_key_node_map_;
+  ObResultCache result_cache_;
 };
 
 template<typename _callback>
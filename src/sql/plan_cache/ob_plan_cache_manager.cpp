@@ -352,6 +352,9 @@ void ObPlanCacheManager::ObPlanCacheEliminationTask::run_plan_cache_task()
           if (OB_FAIL(plan_cache->cache_evict())) {
             SQL_PC_LOG(ERROR, "Plan cache evict failed, please check", K(ret));
           }
+          if (OB_FAIL(plan_cache->get_result_cache().evict())) {
+            SQL_PC_LOG(WARN, "result cache evict failed", K(ret));
+          }
           if (OB_FAIL(plan_cache->asyn_update_baseline())) {
             SQL_PC_LOG(ERROR, "asyn replace plan baseline failed", K(ret), K(tenant_id));
           }
@@ -400,6 +400,9 @@ int ObConfigInfoInPC::load_influence_plan_config()
     rowsets_enabled_ = tenant_config->_rowsets_enabled;
     enable_px_batch_rescan_ = tenant_config->_enable_px_batch_rescan;
     bloom_filter_enabled_ = tenant_config->_bloom_filter_enabled;
+    enable_serial_join_filter_ = tenant_config->_enable_serial_join_filter;
+    px_join_skew_handling_ = tenant_config->_px_join_skew_handling;
+    px_join_skew_minfreq_ = tenant_config->_px_join_skew_minfreq;
   }
 
   return ret;
@@ -430,6 +433,15 @@ int ObConfigInfoInPC::serialize_configs(char *buf, int buf_len, int64_t &pos)
   } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
                               "%d,", enable_newsort_))) {
     SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(enable_newsort_));
+  } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
+                              "%d,", enable_serial_join_filter_))) {
+    SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(enable_serial_join_filter_));
+  } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
+                              "%d,", px_join_skew_handling_))) {
+    SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(px_join_skew_handling_));
+  } else if (OB_FAIL(databuff_printf(buf, buf_len, pos,
+                              "%ld,", px_join_skew_minfreq_))) {
+    SQL_PC_LOG(WARN, "failed to databuff_printf", K(ret), K(px_join_skew_minfreq_));
   } else {
     // do nothing
   }
@@ -941,6 +941,9 @@ public:
     enable_px_batch_rescan_(true),
     bloom_filter_enabled_(true),
     enable_newsort_(true),
+    enable_serial_join_filter_(false),
+    px_join_skew_handling_(true),
+    px_join_skew_minfreq_(30),
     cluster_config_version_(-1),
     tenant_config_version_(-1),
     tenant_id_(0)
@@ -977,6 +980,9 @@ public:
   bool enable_px_ordered_coord_;
   bool bloom_filter_enabled_;
   bool enable_newsort_;
+  bool enable_serial_join_filter_;
+  bool px_join_skew_handling_;
+  int64_t px_join_skew_minfreq_;
 
 private:
   // current cluster config version_
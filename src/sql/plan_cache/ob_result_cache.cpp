@@ -0,0 +1,672 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+
+#include "sql/plan_cache/ob_result_cache.h"
+#include "lib/statistic_event/ob_stat_event.h"
+#include "lib/stat/ob_diagnose_info.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+#include "share/rc/ob_tenant_base.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_physical_plan.h"
+#include "sql/engine/ob_physical_plan_ctx.h"
+#include "sql/plan_cache/ob_plan_cache.h"
+#include "sql/session/ob_sql_session_info.h"
+#include "storage/ls/ob_ls.h"
+#include "storage/tx_storage/ob_ls_service.h"
+#include "storage/tablet/ob_tablet.h"
+#include "storage/ob_i_memtable_mgr.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace storage;
+namespace sql
+{
+
+int ObResultCacheSessionInfo::init(const ObSQLSessionInfo &session)
+{
+  int ret = OB_SUCCESS;
+  const ObTimeZoneInfo *tz_info = session.get_timezone_info();
+  sql_mode_ = session.get_sql_mode();
+  cs_type_ = session.get_local_collation_connection();
+  if (OB_ISNULL(tz_info)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("time zone info is null", K(ret));
+  } else if (OB_FAIL(session.get_div_precision_increment(div_precision_increment_))) {
+    LOG_WARN("failed to get div precision increment", K(ret));
+  } else if (OB_FAIL(session.get_sys_variable(share::SYS_VAR_BLOCK_ENCRYPTION_MODE,
+                                              block_encryption_mode_))) {
+    LOG_WARN("failed to get block encryption mode", K(ret));
+  } else if (OB_FAIL(session.get_group_concat_max_len(group_concat_max_len_))) {
+    LOG_WARN("failed to get group concat max len", K(ret));
+  } else {
+    const ObString date_format = session.get_local_nls_date_format();
+    const ObString timestamp_format = session.get_local_nls_timestamp_format();
+    const ObString timestamp_tz_format = session.get_local_nls_timestamp_tz_format();
+    tz_id_ = tz_info->get_tz_id();
+    tz_offset_ = tz_info->get_offset();
+    nls_format_hash_ = murmurhash(date_format.ptr(), date_format.length(), 0);
+    nls_format_hash_ = murmurhash(timestamp_format.ptr(), timestamp_format.length(),
+                                  nls_format_hash_);
+    nls_format_hash_ = murmurhash(timestamp_tz_format.ptr(), timestamp_tz_format.length(),
+                                  nls_format_hash_);
+  }
+  return ret;
+}
+
+uint64_t ObResultCacheSessionInfo::hash(uint64_t seed) const
+{
+  uint64_t hash_val = seed;
+  hash_val = murmurhash(&sql_mode_, sizeof(sql_mode_), hash_val);
+  hash_val = murmurhash(&cs_type_, sizeof(cs_type_), hash_val);
+  hash_val = murmurhash(&tz_id_, sizeof(tz_id_), hash_val);
+  hash_val = murmurhash(&tz_offset_, sizeof(tz_offset_), hash_val);
+  hash_val = murmurhash(&div_precision_increment_, sizeof(div_precision_increment_), hash_val);
+  hash_val = murmurhash(&block_encryption_mode_, sizeof(block_encryption_mode_), hash_val);
+  hash_val = murmurhash(&group_concat_max_len_, sizeof(group_concat_max_len_), hash_val);
+  hash_val = murmurhash(&nls_format_hash_, sizeof(nls_format_hash_), hash_val);
+  return hash_val;
+}
+
+ObResultCacheValue::ObResultCacheValue(const uint64_t tenant_id)
+  : allocator_("ResultCache", OB_MALLOC_NORMAL_BLOCK_SIZE, tenant_id),
+    key_(),
+    params_(allocator_),
+    session_info_(),
+    tablet_versions_(allocator_),
+    rows_(OB_MALLOC_NORMAL_BLOCK_SIZE, ModulePageAllocator(allocator_)),
+    ref_cnt_(0),
+    last_access_ts_(0)
+{
+}
+
+int ObResultCacheValue::init(const ObResultCacheKey &key,
+                             const ParamStore &params,
+                             const ObResultCacheSessionInfo &session_info,
+                             const ObIArray<ObResultCacheTabletVersion> &tablet_versions)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(params_.init(params.count()))) {
+    LOG_WARN("failed to init params", K(ret), K(params.count()));
+  } else if (OB_FAIL(tablet_versions_.assign(tablet_versions))) {
+    LOG_WARN("failed to assign tablet versions", K(ret));
+  } else {
+    key_ = key;
+    session_info_ = session_info;
+    for (int64_t i = 0; OB_SUCC(ret) && i < params.count(); ++i) {
+      ObObj param;
+      if (OB_FAIL(ob_write_obj(allocator_, params.at(i), param))) {
+        LOG_WARN("failed to deep copy param", K(ret), K(i));
+      } else if (OB_FAIL(params_.push_back(param))) {
+        LOG_WARN("failed to push back param", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObResultCacheValue::add_row(const ObNewRow &row)
+{
+  int ret = OB_SUCCESS;
+  void *buf = NULL;
+  ObNewRow *new_row = NULL;
+  for (int64_t i = 0; OB_SUCC(ret) && i < row.get_count(); ++i) {
+    // lob locators refer to the storage, they can not outlive the statement
+    if (row.get_cell(i).is_lob_locator() || row.get_cell(i).get_meta().has_lob_header()) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("lob is not cached", K(ret), K(i));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObNewRow)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to allocate row", K(ret));
+  } else if (FALSE_IT(new_row = new (buf) ObNewRow())) {
+  } else if (OB_FAIL(ob_write_row(allocator_, row, *new_row))) {
+    LOG_WARN("failed to deep copy row", K(ret));
+  } else if (OB_FAIL(rows_.push_back(new_row))) {
+    LOG_WARN("failed to push back row", K(ret));
+  }
+  return ret;
+}
+
+bool ObResultCacheValue::is_match(const ParamStore &params,
+                                  const ObResultCacheSessionInfo &session_info,
+                                  const ObIArray<ObResultCacheTabletVersion> &tablet_versions) const
+{
+  bool is_match = params.count() == params_.count()
+                  && session_info == session_info_
+                  && is_version_match(tablet_versions);
+  for (int64_t i = 0; is_match && i < params.count(); ++i) {
+    // the key only holds the hash of the parameters
+    is_match = params.at(i).get_collation_type() == params_.at(i).get_collation_type()
+               && params.at(i).strict_equal(params_.at(i));
+  }
+  return is_match;
+}
+
+bool ObResultCacheValue::is_version_match(
+    const ObIArray<ObResultCacheTabletVersion> &tablet_versions) const
+{
+  bool is_match = tablet_versions.count() == tablet_versions_.count();
+  for (int64_t i = 0; is_match && i < tablet_versions.count(); ++i) {
+    is_match = tablet_versions.at(i) == tablet_versions_.at(i);
+  }
+  return is_match;
+}
+
+ObResultCache::ObResultCache()
+  : is_inited_(false),
+    tenant_id_(OB_INVALID_TENANT_ID),
+    mem_used_(0),
+    map_()
+{
+}
+
+int ObResultCache::init(const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(map_.create(BUCKET_NUM, "ResultCacheBkt", "ResultCacheNode", tenant_id))) {
+    LOG_WARN("failed to create result cache map", K(ret), K(tenant_id));
+  } else {
+    tenant_id_ = tenant_id;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObResultCache::destroy()
+{
+  if (IS_INIT) {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(evict_all())) {
+      LOG_WARN("failed to evict all results", K(ret));
+    }
+    map_.destroy();
+    is_inited_ = false;
+  }
+}
+
+struct ObResultCacheRefOp
+{
+  ObResultCacheRefOp() : value_(NULL) {}
+  void operator()(const common::hash::HashMapPair<ObResultCacheKey, ObResultCacheValue *> &entry)
+  {
+    if (NULL != entry.second) {
+      entry.second->inc_ref_count();
+      value_ = entry.second;
+    }
+  }
+  ObResultCacheValue *value_;
+};
+
+int ObResultCache::get(const ObResultCacheKey &key, ObResultCacheValue *&value)
+{
+  int ret = OB_SUCCESS;
+  ObResultCacheRefOp op;
+  value = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(map_.read_atomic(key, op))) {
+    if (OB_HASH_NOT_EXIST != ret) {
+      LOG_WARN("failed to get result", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(op.value_)) {
+    ret = OB_HASH_NOT_EXIST;
+  } else {
+    value = op.value_;
+  }
+  return ret;
+}
+
+int ObResultCache::put(ObResultCacheValue *value)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(value)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret));
+  } else if (get_mem_used() + value->get_mem_size() > get_mem_limit()) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_TRACE("result cache is full", K(ret), K(get_mem_used()), K(value->get_mem_size()));
+  } else {
+    // the map holds a reference of the value
+    value->touch();
+    value->inc_ref_count();
+    if (OB_FAIL(map_.set_refactored(value->get_key(), value))) {
+      value->dec_ref_count();
+      if (OB_HASH_EXIST != ret) {
+        LOG_WARN("failed to add result", K(ret), KPC(value));
+      }
+    } else {
+      (void)ATOMIC_AAF(&mem_used_, value->get_mem_size());
+    }
+  }
+  return ret;
+}
+
+int ObResultCache::erase(const ObResultCacheKey &key)
+{
+  int ret = OB_SUCCESS;
+  ObResultCacheValue *value = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(map_.erase_refactored(key, &value))) {
+    if (OB_HASH_NOT_EXIST == ret) {
+      // erased by others
+      ret = OB_SUCCESS;
+    } else {
+      LOG_WARN("failed to erase result", K(ret), K(key));
+    }
+  } else if (NULL != value) {
+    (void)ATOMIC_SAF(&mem_used_, value->get_mem_size());
+    revert(value);
+  }
+  return ret;
+}
+
+int ObResultCache::alloc_value(ObResultCacheValue *&value)
+{
+  int ret = OB_SUCCESS;
+  void *buf = NULL;
+  value = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(buf = ob_malloc(sizeof(ObResultCacheValue),
+                                       ObMemAttr(tenant_id_, "ResultCache")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to allocate result cache value", K(ret));
+  } else {
+    value = new (buf) ObResultCacheValue(tenant_id_);
+    value->inc_ref_count();
+  }
+  return ret;
+}
+
+void ObResultCache::revert(ObResultCacheValue *value)
+{
+  if (NULL != value && 0 == value->dec_ref_count()) {
+    free_value(value);
+  }
+}
+
+void ObResultCache::free_value(ObResultCacheValue *value)
+{
+  if (NULL != value) {
+    value->~ObResultCacheValue();
+    ob_free(value);
+  }
+}
+
+struct ObResultCacheEvictItem
+{
+  ObResultCacheEvictItem() : key_(), last_access_ts_(0) {}
+  bool operator<(const ObResultCacheEvictItem &other) const
+  {
+    return last_access_ts_ < other.last_access_ts_;
+  }
+  TO_STRING_KV(K_(key), K_(last_access_ts));
+  ObResultCacheKey key_;
+  int64_t last_access_ts_;
+};
+
+struct ObResultCacheCollectOp
+{
+  explicit ObResultCacheCollectOp(ObIArray<ObResultCacheEvictItem> &items) : items_(items) {}
+  int operator()(common::hash::HashMapPair<ObResultCacheKey, ObResultCacheValue *> &entry)
+  {
+    int ret = OB_SUCCESS;
+    ObResultCacheEvictItem item;
+    item.key_ = entry.first;
+    item.last_access_ts_ = NULL == entry.second ? 0 : entry.second->get_last_access_ts();
+    if (OB_FAIL(items_.push_back(item))) {
+      LOG_WARN("failed to push back item", K(ret));
+    }
+    return ret;
+  }
+  ObIArray<ObResultCacheEvictItem> &items_;
+};
+
+int ObResultCache::evict()
+{
+  int ret = OB_SUCCESS;
+  const int64_t mem_limit = get_mem_limit();
+  ObArray<ObResultCacheEvictItem> items;
+  ObResultCacheCollectOp op(items);
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (get_mem_used() <= mem_limit / 100 * EVICT_HIGH_PCT) {
+    // do nothing
+  } else if (OB_FAIL(map_.foreach_refactored(op))) {
+    LOG_WARN("failed to collect results", K(ret));
+  } else {
+    const int64_t mem_low = mem_limit / 100 * EVICT_LOW_PCT;
+    int64_t evict_cnt = 0;
+    std::sort(items.begin(), items.end());
+    for (int64_t i = 0; OB_SUCC(ret) && i < items.count() && get_mem_used() > mem_low; ++i) {
+      if (OB_FAIL(erase(items.at(i).key_))) {
+        LOG_WARN("failed to erase result", K(ret), K(items.at(i)));
+      } else {
+        ++evict_cnt;
+      }
+    }
+    EVENT_ADD(RESULT_CACHE_EVICT, evict_cnt);
+    LOG_INFO("evict result cache", K(ret), K(evict_cnt), K(mem_limit), K(*this));
+  }
+  return ret;
+}
+
+int ObResultCache::evict_all()
+{
+  int ret = OB_SUCCESS;
+  ObArray<ObResultCacheEvictItem> items;
+  ObResultCacheCollectOp op(items);
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(map_.foreach_refactored(op))) {
+    LOG_WARN("failed to collect results", K(ret));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < items.count(); ++i) {
+      if (OB_FAIL(erase(items.at(i).key_))) {
+        LOG_WARN("failed to erase result", K(ret), K(items.at(i)));
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t ObResultCache::get_mem_limit() const
+{
+  int64_t mem_limit = 0;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id_));
+  if (tenant_config.is_valid()) {
+    mem_limit = tenant_config->_result_cache_max_size;
+  }
+  return mem_limit;
+}
+
+int ObResultCache::get_tablet_version(const ObLSID &ls_id,
+                                      const ObTabletID &tablet_id,
+                                      uint64_t &version)
+{
+  int ret = OB_SUCCESS;
+  ObLSService *ls_svr = MTL(ObLSService *);
+  ObLSHandle ls_handle;
+  ObTabletHandle tablet_handle;
+  ObLS *ls = NULL;
+  ObTablet *tablet = NULL;
+  ObIMemtableMgr *memtable_mgr = NULL;
+  ObSEArray<ObITable *, 8> tables;
+  version = 0;
+  if (OB_ISNULL(ls_svr)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("ls service is null", K(ret));
+  } else if (OB_FAIL(ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::DAS_MOD))) {
+    LOG_WARN("failed to get ls", K(ret), K(ls_id));
+  } else if (OB_ISNULL(ls = ls_handle.get_ls())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("ls is null", K(ret), K(ls_id));
+  } else if (OB_FAIL(ls->get_tablet(tablet_id, tablet_handle))) {
+    LOG_WARN("failed to get tablet", K(ret), K(ls_id), K(tablet_id));
+  } else if (OB_ISNULL(tablet = tablet_handle.get_obj())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tablet is null", K(ret), K(tablet_id));
+  } else if (OB_ISNULL(memtable_mgr = tablet->get_memtable_mgr())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("memtable mgr is null", K(ret), K(tablet_id));
+  } else if (OB_FAIL(tablet->get_all_sstables(tables))) {
+    LOG_WARN("failed to get sstables", K(ret), K(tablet_id));
+  } else {
+    // Every commit, including the lazy commit of rows after fast commit and
+    // replay, and every direct load advances the data version of the tablet.
+    // The sstables are hashed as well, so that the entries cached before a
+    // tablet is rebuilt from another replica are not matched.
+    const int64_t data_version = memtable_mgr->get_data_version();
+    version = murmurhash(&data_version, sizeof(data_version), 0);
+    for (int64_t i = 0; OB_SUCC(ret) && i < tables.count(); ++i) {
+      ObITable *table = tables.at(i);
+      if (OB_ISNULL(table)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("table is null", K(ret), K(i));
+      } else {
+        const uint64_t table_hash = table->get_key().hash();
+        version = murmurhash(&table_hash, sizeof(table_hash), version);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObResultCache::get_tablet_versions(ObExecContext &ctx,
+                                       ObIArray<ObResultCacheTabletVersion> &tablet_versions)
+{
+  int ret = OB_SUCCESS;
+  tablet_versions.reset();
+  FOREACH_X(table_node, ctx.get_das_ctx().get_table_loc_list(), OB_SUCC(ret)) {
+    ObDASTableLoc *table_loc = *table_node;
+    if (OB_ISNULL(table_loc)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("table loc is null", K(ret));
+    } else {
+      FOREACH_X(tablet_node, table_loc->get_tablet_locs(), OB_SUCC(ret)) {
+        ObDASTabletLoc *tablet_loc = *tablet_node;
+        ObResultCacheTabletVersion tablet_version;
+        if (OB_ISNULL(tablet_loc)) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("tablet loc is null", K(ret));
+        } else if (FALSE_IT(tablet_version.tablet_id_ = tablet_loc->tablet_id_)) {
+        } else if (OB_FAIL(get_tablet_version(tablet_loc->ls_id_,
+                                              tablet_loc->tablet_id_,
+                                              tablet_version.version_))) {
+          LOG_WARN("failed to get tablet version", K(ret), KPC(tablet_loc));
+        } else if (OB_FAIL(tablet_versions.push_back(tablet_version))) {
+          LOG_WARN("failed to push back tablet version", K(ret));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+void ObResultCacheCtx::reset()
+{
+  if (NULL != result_cache_) {
+    result_cache_->revert(hit_value_);
+    result_cache_->revert(build_value_);
+  }
+  result_cache_ = NULL;
+  hit_value_ = NULL;
+  build_value_ = NULL;
+  row_idx_ = 0;
+  max_result_size_ = 0;
+  row_.reset();
+}
+
+int ObResultCacheCtx::calc_key(const ObPhysicalPlan &plan,
+                               const ParamStore &params,
+                               const ObResultCacheSessionInfo &session_info,
+                               ObResultCacheKey &key)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash_val = session_info.hash(0);
+  for (int64_t i = 0; i < params.count(); ++i) {
+    hash_val = params.at(i).hash(hash_val);
+  }
+  key.plan_id_ = plan.get_plan_id();
+  key.param_hash_ = hash_val;
+  return ret;
+}
+
+int ObResultCacheCtx::prepare(ObExecContext &ctx, const ObPhysicalPlan &plan)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = ctx.get_my_session();
+  ObPhysicalPlanCtx *plan_ctx = ctx.get_physical_plan_ctx();
+  ObPlanCache *plan_cache = NULL;
+  bool need_cache = plan.enable_result_cache() && plan.is_local_plan();
+  reset();
+  if (!need_cache) {
+  } else if (OB_ISNULL(session) || OB_ISNULL(plan_ctx)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("session or plan ctx is null", K(ret), KP(session), KP(plan_ctx));
+  } else if (session->is_in_transaction() || plan_ctx->get_bind_array_count() > 0) {
+    // the uncommitted data and the snapshot of the transaction are not cached
+  } else if (STRONG != plan_ctx->get_consistency_level()) {
+    // weak read may see stale data which is older than the tablet versions,
+    // the consistency comes from the protocol flag, the hint or the session
+  } else if (OB_ISNULL(plan_cache = session->get_plan_cache())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("plan cache is null", K(ret));
+  } else if (plan_cache->get_result_cache().get_mem_limit() <= 0) {
+    // result cache is disabled
+  } else {
+    const ParamStore &params = plan_ctx->get_param_store();
+    ObResultCacheSessionInfo session_info;
+    ObResultCacheTabletVersions tablet_versions;
+    ObResultCacheKey key;
+    ObResultCacheValue *value = NULL;
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session->get_effective_tenant_id()));
+    for (int64_t i = 0; need_cache && i < params.count(); ++i) {
+      need_cache = !params.at(i).is_ext();
+    }
+    if (!need_cache) {
+    } else if (OB_FAIL(session_info.init(*session))) {
+      LOG_WARN("failed to init session info", K(ret));
+    } else if (OB_FAIL(calc_key(plan, params, session_info, key))) {
+      LOG_WARN("failed to calc result cache key", K(ret));
+    } else if (OB_FAIL(ObResultCache::get_tablet_versions(ctx, tablet_versions))) {
+      LOG_WARN("failed to get tablet versions", K(ret));
+    } else if (FALSE_IT(result_cache_ = &plan_cache->get_result_cache())) {
+    } else if (FALSE_IT(max_result_size_ = tenant_config.is_valid()
+                        ? tenant_config->_result_cache_max_result_size : 0)) {
+    } else if (OB_FAIL(result_cache_->get(key, value))) {
+      if (OB_HASH_NOT_EXIST == ret) {
+        ret = OB_SUCCESS;
+      } else {
+        LOG_WARN("failed to get result", K(ret), K(key));
+      }
+    } else if (value->is_match(params, session_info, tablet_versions)) {
+      value->touch();
+      hit_value_ = value;
+      EVENT_INC(RESULT_CACHE_HIT);
+    } else {
+      // the data or the parameters have changed
+      result_cache_->revert(value);
+      if (OB_FAIL(result_cache_->erase(key))) {
+        LOG_WARN("failed to erase result", K(ret), K(key));
+      }
+      EVENT_INC(RESULT_CACHE_INVALIDATE);
+    }
+    if (OB_FAIL(ret) || NULL != hit_value_ || NULL == result_cache_) {
+    } else {
+      EVENT_INC(RESULT_CACHE_MISS);
+      if (max_result_size_ <= 0) {
+      } else if (OB_FAIL(result_cache_->alloc_value(build_value_))) {
+        LOG_WARN("failed to alloc result cache value", K(ret));
+      } else if (OB_FAIL(build_value_->init(key, params, session_info, tablet_versions))) {
+        LOG_WARN("failed to init result cache value", K(ret));
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    reset();
+  }
+  return ret;
+}
+
+int ObResultCacheCtx::get_next_row(ObIAllocator &allocator, const ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  const ObNewRow *cache_row = NULL;
+  if (OB_ISNULL(hit_value_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("result cache is not hit", K(ret));
+  } else if (row_idx_ >= hit_value_->get_row_count()) {
+    ret = OB_ITER_END;
+  } else if (OB_ISNULL(cache_row = hit_value_->get_row(row_idx_))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("cached row is null", K(ret), K(row_idx_));
+  } else {
+    if (NULL == row_.cells_ && cache_row->count_ > 0) {
+      if (OB_ISNULL(row_.cells_ = static_cast<ObObj *>(
+                  allocator.alloc(sizeof(ObObj) * cache_row->count_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("allocate memory failed", K(ret));
+      } else {
+        row_.count_ = cache_row->count_;
+      }
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < cache_row->count_; ++i) {
+      row_.cells_[i] = cache_row->cells_[i];
+    }
+    if (OB_SUCC(ret)) {
+      row = &row_;
+      ++row_idx_;
+    }
+  }
+  return ret;
+}
+
+void ObResultCacheCtx::add_row(const ObNewRow &row)
+{
+  int ret = OB_SUCCESS;
+  if (NULL == build_value_) {
+  } else if (OB_FAIL(build_value_->add_row(row))) {
+    LOG_TRACE("failed to add row, abandon caching", K(ret));
+    abandon_building();
+  } else if (build_value_->get_mem_size() > max_result_size_) {
+    LOG_TRACE("result is too large to cache", K(max_result_size_));
+    abandon_building();
+  }
+}
+
+void ObResultCacheCtx::finish(ObExecContext &ctx)
+{
+  int ret = OB_SUCCESS;
+  ObResultCacheTabletVersions tablet_versions;
+  if (NULL == build_value_ || NULL == result_cache_) {
+  } else if (OB_FAIL(ObResultCache::get_tablet_versions(ctx, tablet_versions))) {
+    LOG_WARN("failed to get tablet versions", K(ret));
+  } else if (!build_value_->is_version_match(tablet_versions)) {
+    // tablets are pruned at runtime or the data is modified during execution,
+    // the result may not match the captured versions
+    LOG_TRACE("tablets changed during execution", K(tablet_versions),
+              K(build_value_->get_tablet_versions()));
+  } else if (OB_FAIL(result_cache_->put(build_value_))) {
+    LOG_TRACE("failed to add result", K(ret));
+  }
+  abandon_building();
+}
+
+void ObResultCacheCtx::abandon_building()
+{
+  if (NULL != result_cache_ && NULL != build_value_) {
+    result_cache_->revert(build_value_);
+  }
+  build_value_ = NULL;
+}
+
+} // namespace sql
+} // namespace oceanbase
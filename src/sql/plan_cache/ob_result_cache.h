@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PLAN_CACHE_OB_RESULT_CACHE_
+#define OCEANBASE_SQL_PLAN_CACHE_OB_RESULT_CACHE_
+
+#include "lib/hash/ob_hashmap.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_fixed_array.h"
+#include "lib/container/ob_se_array.h"
+#include "common/row/ob_row.h"
+#include "common/ob_tablet_id.h"
+#include "share/ob_ls_id.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+class ObExecContext;
+class ObPhysicalPlan;
+class ObSQLSessionInfo;
+
+struct ObResultCacheKey
+{
+  ObResultCacheKey() : plan_id_(common::OB_INVALID_ID), param_hash_(0) {}
+  uint64_t hash() const
+  {
+    return common::murmurhash(&param_hash_, sizeof(param_hash_), plan_id_);
+  }
+  int hash(uint64_t &hash_val) const { hash_val = hash(); return common::OB_SUCCESS; }
+  bool operator==(const ObResultCacheKey &other) const
+  {
+    return plan_id_ == other.plan_id_ && param_hash_ == other.param_hash_;
+  }
+  TO_STRING_KV(K_(plan_id), K_(param_hash));
+  uint64_t plan_id_;
+  // hash of the parameters and the session variables affecting the result
+  uint64_t param_hash_;
+};
+
+struct ObResultCacheTabletVersion
+{
+  ObResultCacheTabletVersion() : tablet_id_(), version_(0) {}
+  bool operator==(const ObResultCacheTabletVersion &other) const
+  {
+    return tablet_id_ == other.tablet_id_ && version_ == other.version_;
+  }
+  TO_STRING_KV(K_(tablet_id), K_(version));
+  common::ObTabletID tablet_id_;
+  // signature of the data version and the sstables of the tablet
+  uint64_t version_;
+};
+
+typedef common::ObSEArray<ObResultCacheTabletVersion, 4> ObResultCacheTabletVersions;
+
+// Everything a cached result depends on besides the table data.
+struct ObResultCacheSessionInfo
+{
+  ObResultCacheSessionInfo()
+    : sql_mode_(0), cs_type_(common::CS_TYPE_INVALID), tz_id_(0), tz_offset_(0),
+      div_precision_increment_(0), block_encryption_mode_(0), group_concat_max_len_(0),
+      nls_format_hash_(0) {}
+  int init(const ObSQLSessionInfo &session);
+  uint64_t hash(uint64_t seed) const;
+  bool operator==(const ObResultCacheSessionInfo &other) const
+  {
+    return sql_mode_ == other.sql_mode_ && cs_type_ == other.cs_type_
+        && tz_id_ == other.tz_id_ && tz_offset_ == other.tz_offset_
+        && div_precision_increment_ == other.div_precision_increment_
+        && block_encryption_mode_ == other.block_encryption_mode_
+        && group_concat_max_len_ == other.group_concat_max_len_
+        && nls_format_hash_ == other.nls_format_hash_;
+  }
+  TO_STRING_KV(K_(sql_mode), K_(cs_type), K_(tz_id), K_(tz_offset),
+               K_(div_precision_increment), K_(block_encryption_mode),
+               K_(group_concat_max_len), K_(nls_format_hash));
+  uint64_t sql_mode_;
+  common::ObCollationType cs_type_;
+  int64_t tz_id_;
+  int64_t tz_offset_;
+  int64_t div_precision_increment_;
+  int64_t block_encryption_mode_;
+  uint64_t group_concat_max_len_;
+  // hash of the nls date, timestamp and timestamp tz formats
+  uint64_t nls_format_hash_;
+};
+
+// Result set of one execution, the rows are deep copied into the arena of the
+// value and never change after the value is added to the cache.
+class ObResultCacheValue
+{
+public:
+  explicit ObResultCacheValue(const uint64_t tenant_id);
+  ~ObResultCacheValue() {}
+  int init(const ObResultCacheKey &key,
+           const common::ParamStore &params,
+           const ObResultCacheSessionInfo &session_info,
+           const common::ObIArray<ObResultCacheTabletVersion> &tablet_versions);
+  int add_row(const common::ObNewRow &row);
+  bool is_match(const common::ParamStore &params,
+                const ObResultCacheSessionInfo &session_info,
+                const common::ObIArray<ObResultCacheTabletVersion> &tablet_versions) const;
+  bool is_version_match(const common::ObIArray<ObResultCacheTabletVersion> &tablet_versions) const;
+  const ObResultCacheKey &get_key() const { return key_; }
+  const common::ObIArray<ObResultCacheTabletVersion> &get_tablet_versions() const
+  { return tablet_versions_; }
+  int64_t get_row_count() const { return rows_.count(); }
+  const common::ObNewRow *get_row(const int64_t idx) const { return rows_.at(idx); }
+  int64_t get_mem_size() const { return allocator_.total() + sizeof(*this); }
+  int64_t get_last_access_ts() const { return ATOMIC_LOAD(&last_access_ts_); }
+  void touch() { ATOMIC_STORE(&last_access_ts_, common::ObTimeUtility::fast_current_time()); }
+  int64_t inc_ref_count() { return ATOMIC_AAF(&ref_cnt_, 1); }
+  int64_t dec_ref_count() { return ATOMIC_SAF(&ref_cnt_, 1); }
+  TO_STRING_KV(K_(key), K_(session_info), K_(tablet_versions), "row_cnt", rows_.count(),
+               K_(ref_cnt), K_(last_access_ts));
+private:
+  common::ObArenaAllocator allocator_;
+  ObResultCacheKey key_;
+  common::ObFixedArray<common::ObObj, common::ObIAllocator> params_;
+  ObResultCacheSessionInfo session_info_;
+  common::ObFixedArray<ObResultCacheTabletVersion, common::ObIAllocator> tablet_versions_;
+  common::ObArray<common::ObNewRow *, common::ModulePageAllocator> rows_;
+  int64_t ref_cnt_;
+  int64_t last_access_ts_;
+  DISALLOW_COPY_AND_ASSIGN(ObResultCacheValue);
+};
+
+// Server side cache of final result sets of queries with the RESULT_CACHE hint,
+// one per tenant owned by the plan cache. Entries are keyed by plan id plus the
+// parameters, and are only valid while the data versions of all the tablets
+// read by the query stay unchanged. Stale entries are dropped when they are
+// looked up, the others are evicted by last access time by the plan cache
+// elimination task once the memory used exceeds _result_cache_max_size.
+class ObResultCache
+{
+public:
+  typedef common::hash::ObHashMap<ObResultCacheKey, ObResultCacheValue *> ResultMap;
+  ObResultCache();
+  ~ObResultCache() { destroy(); }
+  int init(const uint64_t tenant_id);
+  void destroy();
+  // return OB_HASH_NOT_EXIST if not found, or a referenced value otherwise
+  int get(const ObResultCacheKey &key, ObResultCacheValue *&value);
+  int put(ObResultCacheValue *value);
+  int erase(const ObResultCacheKey &key);
+  int alloc_value(ObResultCacheValue *&value);
+  void revert(ObResultCacheValue *value);
+  // evict by last access time down to the low watermark
+  int evict();
+  int evict_all();
+  int64_t get_mem_used() const { return ATOMIC_LOAD(&mem_used_); }
+  int64_t get_mem_limit() const;
+  static int get_tablet_versions(ObExecContext &ctx,
+                                 common::ObIArray<ObResultCacheTabletVersion> &tablet_versions);
+  TO_STRING_KV(K_(is_inited), K_(tenant_id), K_(mem_used), "count", map_.size());
+private:
+  static const int64_t BUCKET_NUM = 1024;
+  static const int64_t EVICT_HIGH_PCT = 90;
+  static const int64_t EVICT_LOW_PCT = 50;
+  static int get_tablet_version(const share::ObLSID &ls_id,
+                                const common::ObTabletID &tablet_id,
+                                uint64_t &version);
+  void free_value(ObResultCacheValue *value);
+private:
+  bool is_inited_;
+  uint64_t tenant_id_;
+  int64_t mem_used_;
+  ResultMap map_;
+  DISALLOW_COPY_AND_ASSIGN(ObResultCache);
+};
+
+// Result cache state of one execution, looks up the cache before the statement
+// starts, and either serves the rows from the cached value or records the rows
+// returned by the plan to add them to the cache when the iteration ends.
+class ObResultCacheCtx
+{
+public:
+  ObResultCacheCtx()
+    : result_cache_(NULL), hit_value_(NULL), build_value_(NULL),
+      row_idx_(0), max_result_size_(0), row_() {}
+  ~ObResultCacheCtx() { reset(); }
+  void reset();
+  int prepare(ObExecContext &ctx, const ObPhysicalPlan &plan);
+  bool is_hit() const { return NULL != hit_value_; }
+  bool is_building() const { return NULL != build_value_; }
+  // the cells of the cached row are shallow copied into a row of the execution,
+  // so that the caller can convert them in place
+  int get_next_row(common::ObIAllocator &allocator, const common::ObNewRow *&row);
+  void add_row(const common::ObNewRow &row);
+  void finish(ObExecContext &ctx);
+private:
+  static int calc_key(const ObPhysicalPlan &plan,
+                      const common::ParamStore &params,
+                      const ObResultCacheSessionInfo &session_info,
+                      ObResultCacheKey &key);
+  void abandon_building();
+private:
+  ObResultCache *result_cache_;
+  ObResultCacheValue *hit_value_;
+  ObResultCacheValue *build_value_;
+  int64_t row_idx_;
+  int64_t max_result_size_;
+  common::ObNewRow row_;
+  DISALLOW_COPY_AND_ASSIGN(ObResultCacheCtx);
+};
+
+} // namespace sql
+} // namespace oceanbase
+
+#endif // OCEANBASE_SQL_PLAN_CACHE_OB_RESULT_CACHE_
@@ -9469,6 +9469,14 @@ int ObDMLResolver::resolve_global_hint(const ParseNode &hint_node,
       global_hint.monitor_ = true;
       break;
     }
+    case T_RESULT_CACHE: {
+      global_hint.merge_result_cache_hint(ObResultCacheOption::ENABLE);
+      break;
+    }
+    case T_NO_RESULT_CACHE: {
+      global_hint.merge_result_cache_hint(ObResultCacheOption::DISABLE);
+      break;
+    }
     case T_TRACING:
     case T_STAT: {
       ObSEArray<ObMonitorHint, 8> monitoring_ids;
@@ -151,6 +151,15 @@ void ObGlobalHint::merge_parallel_hint(int64_t parallel)
   }
 }
 
+// NO_RESULT_CACHE takes precedence
+void ObGlobalHint::merge_result_cache_hint(ObResultCacheOption opt)
+{
+  if (ObResultCacheOption::DISABLE == opt
+      || ObResultCacheOption::NOT_SPECIFIED == result_cache_option_) {
+    result_cache_option_ = opt;
+  }
+}
+
 void ObGlobalHint::merge_parallel_dml_hint(ObPDMLOption pdml_option)
 {
   if (ObPDMLOption::DISABLE != pdml_option_ && ObPDMLOption::ENABLE != pdml_option_) {
@@ -253,6 +262,7 @@ bool ObGlobalHint::has_hint_exclude_concurrent() const
          || false != monitor_
          || ObPDMLOption::NOT_SPECIFIED != pdml_option_
          || ObParamOption::NOT_SPECIFIED != param_option_
+         || ObResultCacheOption::NOT_SPECIFIED != result_cache_option_
          || !monitoring_ids_.empty()
          || !dops_.empty()
          || !opt_params_.empty()
@@ -276,6 +286,7 @@ void ObGlobalHint::reset()
   monitor_ = false;
   pdml_option_ = ObPDMLOption::NOT_SPECIFIED;
   param_option_ = ObParamOption::NOT_SPECIFIED;
+  result_cache_option_ = ObResultCacheOption::NOT_SPECIFIED;
   monitoring_ids_.reuse();
   dops_.reuse();
   opt_features_version_ = UNSET_OPT_FEATURES_VERSION;
@@ -302,6 +313,7 @@ int ObGlobalHint::merge_global_hint(const ObGlobalHint &other)
   merge_parallel_hint(other.parallel_);
   monitor_ |= other.monitor_;
   merge_param_option_hint(other.param_option_);
+  merge_result_cache_hint(other.result_cache_option_);
   merge_opt_features_version_hint(other.opt_features_version_);
   disable_transform_ |= other.disable_transform_;
   disable_cost_based_transform_ |= other.disable_cost_based_transform_;
@@ -433,6 +445,16 @@ int ObGlobalHint::print_global_hint(planText &plan_text) const
       PRINT_GLOBAL_HINT_STR("CURSOR_SHARING_EXACT");
     }
   }
+  if (OB_SUCC(ret) && ObResultCacheOption::NOT_SPECIFIED != result_cache_option_) { // RESULT_CACHE
+    if (ObResultCacheOption::ENABLE == result_cache_option_) {
+      PRINT_GLOBAL_HINT_STR("RESULT_CACHE");
+    } else if (ObResultCacheOption::DISABLE == result_cache_option_) {
+      PRINT_GLOBAL_HINT_STR("NO_RESULT_CACHE");
+    } else {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected result cache hint value", K(ret), K_(result_cache_option));
+    }
+  }
   // OPTIMIZER_FEATURES_ENABLE
   if (OB_SUCC(ret) && (has_valid_opt_features_version() || OUTLINE_DATA == plan_text.outline_type_)) {
     int64_t cur_pos = 0;
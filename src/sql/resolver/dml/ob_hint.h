@@ -118,6 +118,7 @@ struct ObGlobalHint {
   void merge_parallel_hint(int64_t parallel);
   void merge_parallel_dml_hint(ObPDMLOption pdml_option);
   void merge_param_option_hint(ObParamOption opt);
+  void merge_result_cache_hint(ObResultCacheOption opt);
   void merge_topk_hint(int64_t precision, int64_t sharding_minimum_row_count);
   void merge_plan_cache_hint(ObPlanCachePolicy policy);
   void merge_log_level_hint(const ObString &log_level);
@@ -130,6 +131,7 @@ struct ObGlobalHint {
 
   ObPDMLOption get_pdml_option() const { return pdml_option_; }
   ObParamOption get_param_option() const { return param_option_; }
+  bool enable_result_cache() const { return ObResultCacheOption::ENABLE == result_cache_option_; }
   int64_t get_parallel_hint() const { return parallel_; }
   bool has_parallel_hint() const { return UNSET_PARALLEL != parallel_; }
   bool is_topk_specified() const { return topk_precision_ > 0 || sharding_minimum_row_count_ > 0; }
@@ -154,6 +156,7 @@ struct ObGlobalHint {
                K_(monitor),
                K_(pdml_option),
                K_(param_option),
+               K_(result_cache_option),
                K_(monitoring_ids),
                K_(dops),
                K_(opt_features_version),
@@ -176,6 +179,7 @@ struct ObGlobalHint {
   bool monitor_;
   ObPDMLOption pdml_option_;
   ObParamOption param_option_;
+  ObResultCacheOption result_cache_option_;
   common::ObSArray<ObMonitorHint> monitoring_ids_;
   common::ObSArray<ObDopHint> dops_;
   uint64_t opt_features_version_;
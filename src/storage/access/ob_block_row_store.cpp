@@ -173,7 +173,16 @@ int ObBlockRowStore::filter_micro_block(
   } else if (nullptr != parent && OB_FAIL(parent->prepare_skip_filter())) {
     LOG_WARN("Failed to check parent blockscan", K(ret));
   } else if (filter->is_filter_node()) {
-    if (OB_FAIL(micro_scanner.filter_pushdown_filter(parent, filter, pd_filter_info_, *result))) {
+    bool pass_all = false;
+    if (filter->is_filter_black_node()
+        && static_cast<sql::ObBlackFilterExecutor *>(filter)->is_runtime_filter()
+        && OB_FAIL(static_cast<sql::ObBlackFilterExecutor *>(filter)->check_runtime_filter_pass_all(
+                    row_count, pass_all))) {
+      LOG_WARN("Failed to check runtime filter", K(ret), KPC(filter));
+    } else if (pass_all) {
+      // runtime filter is not ready, skip decoding and filtering of the micro block
+      result->reuse(true);
+    } else if (OB_FAIL(micro_scanner.filter_pushdown_filter(parent, filter, pd_filter_info_, *result))) {
       LOG_WARN("Failed to filter pushdown filter", K(ret), KPC(filter));
     }
   } else if (filter->is_logic_op_node()) {
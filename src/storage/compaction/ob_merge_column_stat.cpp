@@ -0,0 +1,393 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_merge_column_stat.h"
+#include "ob_medium_compaction_func.h"
+#include "ob_tablet_merge_ctx.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+#include "share/schema/ob_tenant_schema_service.h"
+#include "share/stat/ob_opt_stat_manager.h"
+#include "storage/ob_storage_schema.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace share::schema;
+using namespace storage;
+using namespace blocksstable;
+
+namespace compaction
+{
+
+ObMergeColumnStat::ObMergeColumnStat(ObIAllocator &allocator)
+  : allocator_(allocator),
+    lock_(),
+    columns_(allocator),
+    store_column_cnt_(0),
+    row_count_(0),
+    total_row_len_(0),
+    is_inited_(false)
+{
+}
+
+ObMergeColumnStat::~ObMergeColumnStat()
+{
+  reset();
+}
+
+void ObMergeColumnStat::reset()
+{
+  for (int64_t i = 0; i < columns_.count(); ++i) {
+    ColumnItem &item = columns_.at(i);
+    if (OB_NOT_NULL(item.stat_)) {
+      item.stat_->~ObColumnStat();
+      allocator_.free(item.stat_);
+      item.stat_ = nullptr;
+    }
+  }
+  columns_.reset();
+  store_column_cnt_ = 0;
+  row_count_ = 0;
+  total_row_len_ = 0;
+  is_inited_ = false;
+}
+
+bool ObMergeColumnStat::is_supported_type(const ObObjMeta &meta_type)
+{
+  const ObObjType type = meta_type.get_type();
+  return !(ob_is_large_text(type) || ob_is_json(type) || ob_is_geometry(type)
+      || ob_is_lob_locator(type));
+}
+
+bool ObMergeColumnStat::need_collect(const ObTabletMergeCtx &ctx)
+{
+  bool bret = false;
+  const ObStorageSchema *schema = ctx.get_schema();
+  if (!is_major_merge_type(ctx.param_.merge_type_)
+      || !ctx.is_full_merge_
+      || ctx.param_.tablet_id_.is_inner_tablet()
+      || OB_ISNULL(schema)
+      || USER_TABLE != schema->get_table_type()) {
+    // only the full major merge of user tables rewrites every row
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (tenant_config.is_valid()) {
+      bret = tenant_config->_enable_stat_collection_in_major_merge;
+    }
+  }
+  if (bret) {
+    // every replica merges the tablet, only the leader publishes the statistics
+    ObRole role = INVALID_ROLE;
+    if (OB_SUCCESS != ObMediumCompactionScheduleFunc::get_palf_role(ctx.param_.ls_id_, role)
+        || !is_leader_by_election(role)) {
+      bret = false;
+    }
+  }
+  return bret;
+}
+
+int ObMergeColumnStat::init(const ObStorageSchema &schema)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObColDesc, OB_DEFAULT_SE_ARRAY_COUNT> col_descs;
+  const int64_t rowkey_cnt = schema.get_rowkey_column_num();
+  const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("merge column stat init twice", K(ret));
+  } else if (OB_FAIL(schema.get_multi_version_column_descs(col_descs))) {
+    LOG_WARN("failed to get multi version column descs", K(ret));
+  } else if (OB_FAIL(columns_.init(col_descs.count()))) {
+    LOG_WARN("failed to init columns", K(ret), K(col_descs.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < col_descs.count(); ++i) {
+    ColumnItem item;
+    void *buf = nullptr;
+    if (i >= rowkey_cnt && i < rowkey_cnt + extra_rowkey_cnt) {
+      // skip multi version columns
+    } else if (!is_supported_type(col_descs.at(i).col_type_)) {
+    } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObColumnStat)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc column stat", K(ret));
+    } else {
+      item.store_idx_ = i;
+      item.meta_type_ = col_descs.at(i).col_type_;
+      item.stat_ = new (buf) ObColumnStat(allocator_);
+      if (OB_UNLIKELY(!item.stat_->is_writable())) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc column stat buffer", K(ret));
+      }
+      if (OB_FAIL(ret)) {
+        item.stat_->~ObColumnStat();
+        allocator_.free(item.stat_);
+      } else if (OB_FAIL(columns_.push_back(item))) {
+        LOG_WARN("failed to push back column item", K(ret));
+        item.stat_->~ObColumnStat();
+        allocator_.free(item.stat_);
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    reset();
+  } else {
+    store_column_cnt_ = col_descs.count();
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObMergeColumnStat::collect(const ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  ObObj obj;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("merge column stat not init", K(ret));
+  } else if (OB_UNLIKELY(row.count_ != store_column_cnt_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected column count of row", K(ret), K(row.count_), K_(store_column_cnt));
+  } else {
+    int64_t row_len = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < columns_.count(); ++i) {
+      ColumnItem &item = columns_.at(i);
+      const ObStorageDatum &datum = row.storage_datums_[item.store_idx_];
+      if (datum.is_nop()) {
+        // the merged row of major sstable is complete, the column is filled by default value
+      } else if (OB_FAIL(datum.to_obj_enhance(obj, item.meta_type_))) {
+        LOG_WARN("failed to transfer datum to obj", K(ret), K(datum), K(item));
+      } else if (OB_FAIL(item.stat_->add_value(obj))) {
+        LOG_WARN("failed to add value to column stat", K(ret), K(obj));
+      } else {
+        item.total_len_ += datum.len_;
+        row_len += datum.len_;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ++row_count_;
+      total_row_len_ += row_len;
+    }
+  }
+  return ret;
+}
+
+int ObMergeColumnStat::merge(const ObMergeColumnStat &other)
+{
+  int ret = OB_SUCCESS;
+  lib::ObMutexGuard guard(lock_);
+  if (IS_NOT_INIT || !other.is_inited()) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("merge column stat not init", K(ret), K(other));
+  } else if (OB_UNLIKELY(other.columns_.count() != columns_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("column count not match", K(ret), K(other), KPC(this));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < columns_.count(); ++i) {
+    ColumnItem &item = columns_.at(i);
+    if (OB_FAIL(item.stat_->add(*other.columns_.at(i).stat_))) {
+      LOG_WARN("failed to merge column stat", K(ret), K(i));
+    } else {
+      item.total_len_ += other.columns_.at(i).total_len_;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    row_count_ += other.row_count_;
+    total_row_len_ += other.total_row_len_;
+  }
+  return ret;
+}
+
+int ObMergeColumnStat::get_partition_id(
+    const ObTableSchema &table_schema,
+    const ObTabletID &tablet_id,
+    int64_t &partition_id,
+    int64_t &stat_level) const
+{
+  int ret = OB_SUCCESS;
+  int64_t part_id = OB_INVALID_ID;
+  int64_t subpart_id = OB_INVALID_ID;
+  if (PARTITION_LEVEL_ZERO == table_schema.get_part_level()) {
+    partition_id = table_schema.get_table_id();
+    stat_level = TABLE_LEVEL;
+  } else if (OB_FAIL(table_schema.get_part_id_by_tablet(tablet_id, part_id, subpart_id))) {
+    LOG_WARN("failed to get part id by tablet", K(ret), K(tablet_id));
+  } else if (PARTITION_LEVEL_ONE == table_schema.get_part_level()) {
+    partition_id = part_id;
+    stat_level = PARTITION_LEVEL;
+  } else {
+    partition_id = subpart_id;
+    stat_level = SUBPARTITION_LEVEL;
+  }
+  return ret;
+}
+
+int ObMergeColumnStat::report(const ObTabletMergeCtx &ctx)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t tenant_id = MTL_ID();
+  const ObTabletID &tablet_id = ctx.param_.tablet_id_;
+  const int64_t schema_version = ctx.schema_ctx_.schema_version_;
+  ObMultiVersionSchemaService *schema_service = nullptr;
+  ObSchemaGetterGuard schema_guard;
+  const ObTableSchema *table_schema = nullptr;
+  ObSEArray<ObTabletID, 1> tablet_ids;
+  ObSEArray<uint64_t, 1> table_ids;
+  int64_t save_schema_version = schema_version;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("merge column stat not init", K(ret));
+  } else if (OB_ISNULL(schema_service = MTL(ObTenantSchemaService *)->get_schema_service())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("failed to get schema service from MTL", K(ret));
+  } else if (OB_FAIL(tablet_ids.push_back(tablet_id))) {
+    LOG_WARN("failed to add tablet id", K(ret));
+  } else if (OB_FAIL(schema_service->get_tablet_to_table_history(
+      tenant_id, tablet_ids, schema_version, table_ids))) {
+    LOG_WARN("failed to get table id according to tablet id", K(ret), K(schema_version));
+  } else if (table_ids.empty() || OB_INVALID_ID == table_ids.at(0)) {
+    // table is deleted
+  } else if (OB_FAIL(schema_service->retry_get_schema_guard(tenant_id,
+                                                            schema_version,
+                                                            table_ids.at(0),
+                                                            schema_guard,
+                                                            save_schema_version))) {
+    if (OB_TABLE_IS_DELETED != ret) {
+      LOG_WARN("failed to get schema guard", K(ret), K(schema_version), K(table_ids));
+    } else {
+      ret = OB_SUCCESS;
+    }
+  } else if (OB_FAIL(schema_guard.get_table_schema(tenant_id, table_ids.at(0), table_schema))) {
+    LOG_WARN("failed to get table schema", K(ret), K(table_ids));
+  } else if (OB_ISNULL(table_schema) || !table_schema->is_user_table()) {
+    // table is deleted
+  } else if (table_schema->get_schema_version() > schema_version) {
+    // columns may be changed after the merge schema, give up this round
+    LOG_INFO("schema changed, skip reporting merge column stat", K(tablet_id),
+             K(schema_version), "table_schema_version", table_schema->get_schema_version());
+  } else if (OB_FAIL(inner_report(ctx, *table_schema, schema_guard))) {
+    LOG_WARN("failed to report merge column stat", K(ret), K(tablet_id));
+  }
+  return ret;
+}
+
+int ObMergeColumnStat::inner_report(
+    const ObTabletMergeCtx &ctx,
+    const ObTableSchema &table_schema,
+    ObSchemaGetterGuard &schema_guard)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t tenant_id = MTL_ID();
+  const uint64_t table_id = table_schema.get_table_id();
+  ObArenaAllocator allocator("MergeColStat");
+  ObSEArray<ObColDesc, OB_DEFAULT_SE_ARRAY_COUNT> col_descs;
+  ObSEArray<ObOptTableStat *, 1> table_stats;
+  ObSEArray<ObOptColumnStat *, OB_DEFAULT_SE_ARRAY_COUNT> column_stats;
+  obrpc::ObUpdateStatCacheArg stat_arg;
+  ObOptTableStat table_stat;
+  ObOptTableStat old_table_stat;
+  int64_t partition_id = OB_INVALID_ID;
+  int64_t stat_level = INVALID_LEVEL;
+  if (OB_FAIL(table_schema.get_multi_version_column_descs(col_descs))) {
+    LOG_WARN("failed to get multi version column descs", K(ret));
+  } else if (OB_UNLIKELY(col_descs.count() != store_column_cnt_)) {
+    ret = OB_SCHEMA_ERROR;
+    LOG_WARN("column count not match", K(ret), K(col_descs.count()), K_(store_column_cnt));
+  } else if (OB_FAIL(get_partition_id(table_schema, ctx.param_.tablet_id_, partition_id, stat_level))) {
+    LOG_WARN("failed to get partition id", K(ret));
+  } else if (OB_FAIL(ObOptStatManager::get_instance().get_table_stat(
+      tenant_id, ObOptTableStat::Key(tenant_id, table_id, partition_id), old_table_stat))) {
+    LOG_WARN("failed to get table stat", K(ret), K(table_id), K(partition_id));
+  } else if (old_table_stat.get_stattype_locked() > 0) {
+    LOG_INFO("statistics are locked, skip reporting merge column stat", K(table_id), K(partition_id));
+  } else {
+    table_stat.set_table_id(table_id);
+    table_stat.set_partition_id(partition_id);
+    table_stat.set_object_type(stat_level);
+    table_stat.set_row_count(row_count_);
+    table_stat.set_avg_row_size(row_count_ > 0 ? total_row_len_ / row_count_ : 0);
+    table_stat.set_sstable_row_count(row_count_);
+    stat_arg.tenant_id_ = tenant_id;
+    stat_arg.table_id_ = table_id;
+    // merges of many partitions finish together, let plans pick up the statistics when they expire
+    stat_arg.no_invalidate_ = true;
+    if (OB_FAIL(table_stats.push_back(&table_stat))) {
+      LOG_WARN("failed to push back table stat", K(ret));
+    } else if (OB_FAIL(stat_arg.partition_ids_.push_back(partition_id))) {
+      LOG_WARN("failed to push back partition id", K(ret));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && 0 == old_table_stat.get_stattype_locked() && i < columns_.count(); ++i) {
+    const ColumnItem &item = columns_.at(i);
+    const ObColDesc &col_desc = col_descs.at(item.store_idx_);
+    ObColumnStat &stat = *item.stat_;
+    ObOptColumnStat *col_stat = nullptr;
+    void *buf = nullptr;
+    if (col_desc.col_id_ < OB_APP_MIN_COLUMN_ID) {
+      // hidden primary key
+    } else if (OB_UNLIKELY(col_desc.col_type_.get_type() != item.meta_type_.get_type())) {
+      ret = OB_SCHEMA_ERROR;
+      LOG_WARN("column type not match", K(ret), K(col_desc), K(item));
+    } else if (OB_FAIL(stat.finish())) {
+      LOG_WARN("failed to finish column stat", K(ret));
+    } else if (OB_ISNULL(buf = allocator.alloc(sizeof(ObOptColumnStat)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc column stat", K(ret));
+    } else if (FALSE_IT(col_stat = new (buf) ObOptColumnStat(allocator))) {
+    } else if (OB_ISNULL(col_stat->get_llc_bitmap())) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc llc bitmap", K(ret));
+    } else {
+      col_stat->set_table_id(table_id);
+      col_stat->set_partition_id(partition_id);
+      col_stat->set_column_id(col_desc.col_id_);
+      col_stat->set_stat_level(stat_level);
+      col_stat->set_collation_type(item.meta_type_.get_collation_type());
+      col_stat->set_num_null(stat.get_num_null());
+      col_stat->set_num_not_null(row_count_ - stat.get_num_null());
+      col_stat->set_num_distinct(stat.get_num_distinct());
+      col_stat->set_avg_len(row_count_ > 0 ? item.total_len_ / row_count_ : 0);
+      MEMCPY(col_stat->get_llc_bitmap(), stat.get_llc_bitmap(), ObColumnStat::NUM_LLC_BUCKET);
+      if (!stat.get_min_value().is_min_value()) {
+        col_stat->set_min_value(stat.get_min_value());
+      }
+      if (!stat.get_max_value().is_max_value()) {
+        col_stat->set_max_value(stat.get_max_value());
+      }
+      if (OB_FAIL(column_stats.push_back(col_stat))) {
+        LOG_WARN("failed to push back column stat", K(ret));
+      } else if (OB_FAIL(stat_arg.column_ids_.push_back(col_desc.col_id_))) {
+        LOG_WARN("failed to push back column id", K(ret));
+      }
+    }
+  }
+  if (OB_FAIL(ret) || table_stats.empty()) {
+  } else if (OB_FAIL(ObOptStatManager::get_instance().batch_write(&schema_guard,
+                                                                  tenant_id,
+                                                                  table_stats,
+                                                                  column_stats,
+                                                                  ObTimeUtility::current_time(),
+                                                                  false/*is_index_stat*/,
+                                                                  false/*is_history_stat*/))) {
+    LOG_WARN("failed to write merge column stat", K(ret), K(table_id), K(partition_id));
+  } else if (OB_FAIL(ObOptStatManager::get_instance().add_refresh_stat_task(stat_arg))) {
+    LOG_WARN("failed to refresh stat cache", K(ret), K(stat_arg));
+  } else {
+    FLOG_INFO("succeed to report merge column stat", K(table_id), K(partition_id),
+              K_(row_count), "column_cnt", column_stats.count());
+  }
+  return ret;
+}
+
+} // namespace compaction
+} // namespace oceanbase
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_COMPACTION_OB_MERGE_COLUMN_STAT_H_
+#define OCEANBASE_COMPACTION_OB_MERGE_COLUMN_STAT_H_
+
+#include "lib/container/ob_fixed_array.h"
+#include "lib/lock/ob_mutex.h"
+#include "share/stat/ob_column_stat.h"
+#include "storage/blocksstable/ob_datum_row.h"
+
+namespace oceanbase
+{
+namespace share
+{
+namespace schema
+{
+class ObTableSchema;
+class ObSchemaGetterGuard;
+}
+}
+namespace storage
+{
+class ObStorageSchema;
+}
+namespace compaction
+{
+struct ObTabletMergeCtx;
+
+// Optimizer statistics gathered from the rows written by a full major merge.
+// Every merge task collects the rows of its own range and merges them into the
+// collector of the tablet when it closes, the finish task then publishes them
+// as the statistics of the partition, so no extra scan is needed to refresh them.
+//
+// Columns are identified by their position in the stored row, real column ids
+// are only resolved from the table schema when the statistics are published.
+class ObMergeColumnStat
+{
+public:
+  explicit ObMergeColumnStat(common::ObIAllocator &allocator);
+  ~ObMergeColumnStat();
+  void reset();
+  int init(const storage::ObStorageSchema &schema);
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  int collect(const blocksstable::ObDatumRow &row);
+  // called by the parallel merge tasks
+  int merge(const ObMergeColumnStat &other);
+  int report(const ObTabletMergeCtx &ctx);
+  static bool need_collect(const ObTabletMergeCtx &ctx);
+  TO_STRING_KV(K_(is_inited), K_(store_column_cnt), K_(row_count), K_(total_row_len),
+               "column_cnt", columns_.count());
+private:
+  struct ColumnItem
+  {
+    ColumnItem() : store_idx_(0), meta_type_(), total_len_(0), stat_(nullptr) {}
+    TO_STRING_KV(K_(store_idx), K_(meta_type), K_(total_len), KPC_(stat));
+    int64_t store_idx_;
+    common::ObObjMeta meta_type_;
+    int64_t total_len_;
+    common::ObColumnStat *stat_;
+  };
+  static bool is_supported_type(const common::ObObjMeta &meta_type);
+  int get_partition_id(
+      const share::schema::ObTableSchema &table_schema,
+      const common::ObTabletID &tablet_id,
+      int64_t &partition_id,
+      int64_t &stat_level) const;
+  int inner_report(
+      const ObTabletMergeCtx &ctx,
+      const share::schema::ObTableSchema &table_schema,
+      share::schema::ObSchemaGetterGuard &schema_guard);
+private:
+  common::ObIAllocator &allocator_;
+  lib::ObMutex lock_;
+  common::ObFixedArray<ColumnItem, common::ObIAllocator> columns_;
+  int64_t store_column_cnt_;
+  int64_t row_count_;
+  int64_t total_row_len_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObMergeColumnStat);
+};
+
+} // namespace compaction
+} // namespace oceanbase
+
+#endif // OCEANBASE_COMPACTION_OB_MERGE_COLUMN_STAT_H_
@@ -420,12 +420,24 @@ template <typename T> T *ObPartitionMerger::alloc_merge_helper()
  */
 ObPartitionMajorMerger::ObPartitionMajorMerger()
   : rewrite_block_cnt_(0),
-    need_rewrite_block_cnt_(0)
+    need_rewrite_block_cnt_(0),
+    column_stat_(nullptr)
 {
 }
 
 ObPartitionMajorMerger::~ObPartitionMajorMerger()
 {
+  reset();
+}
+
+void ObPartitionMajorMerger::reset()
+{
+  if (OB_NOT_NULL(column_stat_)) {
+    column_stat_->~ObMergeColumnStat();
+    allocator_.free(column_stat_);
+    column_stat_ = nullptr;
+  }
+  ObPartitionMerger::reset();
 }
 
 int ObPartitionMajorMerger::open(ObTabletMergeCtx &ctx, const int64_t idx)
@@ -449,12 +461,35 @@ int ObPartitionMajorMerger::open(ObTabletMergeCtx &ctx, const int64_t idx)
     data_store_desc_.sstable_index_builder_ = ctx.get_merge_info().get_index_builder();
     rewrite_block_cnt_ = 0;
     need_rewrite_block_cnt_ = 0;
-    is_inited_ = true;
+    if (OB_NOT_NULL(ctx.column_stat_)) {
+      void *buf = nullptr;
+      if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObMergeColumnStat)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        STORAGE_LOG(WARN, "Failed to allocate memory for merge column stat", K(ret));
+      } else if (FALSE_IT(column_stat_ = new (buf) ObMergeColumnStat(allocator_))) {
+      } else if (OB_FAIL(column_stat_->init(*ctx.get_schema()))) {
+        STORAGE_LOG(WARN, "Failed to init merge column stat", K(ret));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      is_inited_ = true;
+    }
   }
 
   return ret;
 }
 
+int ObPartitionMajorMerger::close()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(ObPartitionMerger::close())) {
+    STORAGE_LOG(WARN, "Failed to close partition merger", K(ret));
+  } else if (OB_NOT_NULL(column_stat_) && OB_FAIL(merge_ctx_->column_stat_->merge(*column_stat_))) {
+    STORAGE_LOG(WARN, "Failed to merge column stat", K(ret));
+  }
+  return ret;
+}
+
 int ObPartitionMajorMerger::inner_process(const ObDatumRow &row)
 {
   int ret = OB_SUCCESS;
@@ -467,6 +502,8 @@ int ObPartitionMajorMerger::inner_process(const ObDatumRow &row)
       STORAGE_LOG(WARN, "Failed to get base iter macro", K(ret));
     } else if (OB_FAIL(macro_writer_->append_row(row, macro_desc))) {
       STORAGE_LOG(WARN, "Failed to append row to macro writer", K(ret));
+    } else if (OB_NOT_NULL(column_stat_) && OB_FAIL(column_stat_->collect(row))) {
+      STORAGE_LOG(WARN, "Failed to collect column stat", K(ret));
     }
   }
 
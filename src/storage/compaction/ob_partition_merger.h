@@ -26,6 +26,7 @@
 #include "storage/blocksstable/ob_sstable.h"
 #include "lib/container/ob_loser_tree.h"
 #include "storage/compaction/ob_partition_rows_merger.h"
+#include "storage/compaction/ob_merge_column_stat.h"
 
 namespace oceanbase
 {
@@ -90,10 +91,12 @@ class ObPartitionMajorMerger : public ObPartitionMerger
 public:
   ObPartitionMajorMerger();
   ~ObPartitionMajorMerger();
+  virtual void reset() override;
   virtual int merge_partition(ObTabletMergeCtx &ctx, const int64_t idx) override;
-  INHERIT_TO_STRING_KV("ObPartitionMajorMerger", ObPartitionMerger, KPC(merge_progress_));
+  INHERIT_TO_STRING_KV("ObPartitionMajorMerger", ObPartitionMerger, KPC(merge_progress_), KPC_(column_stat));
 protected:
   virtual int open(ObTabletMergeCtx &ctx, const int64_t idx) override;
+  virtual int close() override;
   virtual int inner_process(const blocksstable::ObDatumRow &row) override;
   virtual int init_partition_fuser(const ObMergeParameter &merge_param) override;
   virtual int try_rewrite_macro_block(const ObMacroBlockDesc &macro_desc, bool &rewrite) override;
@@ -107,6 +110,7 @@ private:
 private:
   int64_t rewrite_block_cnt_;
   int64_t need_rewrite_block_cnt_;
+  ObMergeColumnStat *column_stat_; // statistics of the rows written by this task
 };
 
 class ObPartitionMinorMerger : public ObPartitionMerger
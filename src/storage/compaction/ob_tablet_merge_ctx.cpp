@@ -522,6 +522,7 @@ ObTabletMergeCtx::ObTabletMergeCtx(
     merge_dag_(nullptr),
     merge_progress_(nullptr),
     compaction_filter_(nullptr),
+    column_stat_(nullptr),
     time_guard_(),
     rebuild_seq_(-1),
     data_version_(0),
@@ -547,6 +548,11 @@ void ObTabletMergeCtx::destroy()
     allocator_.free(compaction_filter_);
     compaction_filter_ = nullptr;
   }
+  if (OB_NOT_NULL(column_stat_)) {
+    column_stat_->~ObMergeColumnStat();
+    allocator_.free(column_stat_);
+    column_stat_ = nullptr;
+  }
   tables_handle_.reset();
   tablet_handle_.reset();
 }
@@ -1170,6 +1176,27 @@ int ObTabletMergeCtx::prepare_merge_progress()
   return ret;
 }
 
+int ObTabletMergeCtx::prepare_column_stat()
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (OB_NOT_NULL(column_stat_) || !ObMergeColumnStat::need_collect(*this)) {
+    // do nothing
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObMergeColumnStat)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc memory for merge column stat", K(ret));
+  } else {
+    column_stat_ = new (buf) ObMergeColumnStat(allocator_);
+    if (OB_FAIL(column_stat_->init(*get_schema()))) {
+      LOG_WARN("failed to init merge column stat", K(ret));
+      column_stat_->~ObMergeColumnStat();
+      allocator_.free(column_stat_);
+      column_stat_ = nullptr;
+    }
+  }
+  return ret;
+}
+
 int ObTabletMergeCtx::generate_participant_table_info(char *buf, const int64_t buf_len) const
 {
   int ret = OB_SUCCESS;
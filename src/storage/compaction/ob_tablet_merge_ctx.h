@@ -21,6 +21,7 @@
 #include "storage/compaction/ob_partition_merge_progress.h"
 #include "storage/compaction/ob_tablet_merge_task.h"
 #include "storage/compaction/ob_partition_merge_policy.h"
+#include "storage/compaction/ob_merge_column_stat.h"
 #include "storage/tx_storage/ob_ls_map.h"
 #include "storage/tx_storage/ob_ls_handle.h"
 #include "share/scn.h"
@@ -179,6 +180,7 @@ public:
   int init_merge_info();
   int prepare_index_tree();
   int prepare_merge_progress();
+  int prepare_column_stat();
   int generate_participant_table_info(char *buf, const int64_t buf_len) const;
   int generate_macro_id_list(char *buf, const int64_t buf_len) const;
   void collect_running_info();
@@ -240,6 +242,7 @@ public:
   ObBasicTabletMergeDag *merge_dag_;
   compaction::ObPartitionMergeProgress *merge_progress_;
   compaction::ObICompactionFilter *compaction_filter_;
+  compaction::ObMergeColumnStat *column_stat_; // not null if the merge collects optimizer statistics
   ObCompactionTimeGuard time_guard_;
   int64_t rebuild_seq_;
   uint64_t data_version_;
@@ -825,6 +825,9 @@ int ObTabletMergePrepareTask::process()
     if (OB_TMP_FAIL(ctx->prepare_merge_progress())) {
       LOG_WARN("failed to init merge progress", K(tmp_ret));
     }
+    if (OB_TMP_FAIL(ctx->prepare_column_stat())) {
+      LOG_WARN("failed to prepare merge column stat", K(tmp_ret));
+    }
     FLOG_INFO("succeed to init merge ctx", "task", *this);
   }
   if (OB_FAIL(ret)) {
@@ -1032,6 +1035,12 @@ int ObTabletMergeFinishTask::process()
         LOG_WARN("failed to update tablet report status", K(tmp_ret), K(tablet_id));
       }
     }
+    if (OB_SUCC(ret) && OB_NOT_NULL(ctx.column_stat_)) {
+      // statistics are a by-product of the merge, failing to publish them does not fail the merge
+      if (OB_TMP_FAIL(ctx.column_stat_->report(ctx))) {
+        LOG_WARN("failed to report merge column stat", K(tmp_ret), K(tablet_id));
+      }
+    }
 
     if (OB_SUCC(ret) && OB_NOT_NULL(ctx.merge_progress_)) {
       if (OB_TMP_FAIL(ctx.merge_progress_->update_merge_info(ctx.merge_info_.get_sstable_merge_info()))) {
@@ -674,6 +674,10 @@ int ObTabletDDLUtil::create_ddl_sstable(ObSSTableIndexBuilder *sstable_index_bui
           if (OB_FAIL(ls_handle.get_ls()->update_tablet_table_store(ddl_param.table_key_.get_tablet_id(), table_store_param, new_tablet_handle))) {
             LOG_WARN("failed to update tablet table store", K(ret), K(ddl_param.table_key_), K(table_store_param));
           } else {
+            if (OB_NOT_NULL(new_tablet_handle.get_obj()->get_memtable_mgr())) {
+              // the direct loaded data is visible now
+              new_tablet_handle.get_obj()->get_memtable_mgr()->inc_data_version();
+            }
             LOG_INFO("create ddl sstable success", K(ddl_param), K(param), K(table_store_param));
           }
         }
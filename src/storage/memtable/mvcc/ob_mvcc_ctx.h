@@ -155,6 +155,10 @@ public:
   inline int64_t get_lock_wait_start_ts() const { return lock_wait_start_ts_; }
   void acquire_callback_list() { trans_mgr_.acquire_callback_list(); }
   void revert_callback_list() { trans_mgr_.revert_callback_list(); }
+  int add_lazy_callback_tablet(const common::ObTabletID &tablet_id)
+  { return trans_mgr_.add_lazy_callback_tablet(tablet_id); }
+  bool need_inc_data_version(const common::ObTabletID &tablet_id)
+  { return trans_mgr_.need_inc_data_version(tablet_id); }
 
   int register_row_commit_cb(
       const ObMemtableKey *key,
@@ -24,6 +24,8 @@
 #include "storage/tx/ob_trans_part_ctx.h"
 #include "ob_mvcc_ctx.h"
 #include "storage/memtable/ob_memtable_interface.h"
+#include "storage/tx_storage/ob_ls_service.h"
+#include "storage/tablet/ob_tablet.h"
 
 namespace oceanbase
 {
@@ -221,6 +223,8 @@ void ObTransCallbackMgr::reset()
   callback_remove_for_rollback_to_count_ = 0;
   pending_log_size_ = 0;
   flushed_log_size_ = 0;
+  lazy_callback_tablet_ids_.reset();
+  versioned_tablet_ids_.reset();
 }
 
 int ObTransCallbackMgr::append(ObITransCallback *node)
@@ -404,6 +408,81 @@ int ObTransCallbackMgr::remove_callback_for_uncommited_txn(ObIMemtable *memtable
   return ret;
 }
 
+int ObTransCallbackMgr::add_lazy_callback_tablet(const ObTabletID &tablet_id)
+{
+  int ret = OB_SUCCESS;
+  const int64_t cnt = lazy_callback_tablet_ids_.count();
+  // callbacks of the same tablet are mostly adjacent
+  if (cnt > 0 && lazy_callback_tablet_ids_.at(cnt - 1) == tablet_id) {
+  } else if (has_exist_in_array(lazy_callback_tablet_ids_, tablet_id)) {
+  } else if (OB_FAIL(lazy_callback_tablet_ids_.push_back(tablet_id))) {
+    TRANS_LOG(WARN, "push back lazy callback tablet failed", K(ret), K(tablet_id));
+  }
+  return ret;
+}
+
+bool ObTransCallbackMgr::need_inc_data_version(const ObTabletID &tablet_id)
+{
+  bool bret = true;
+  int ret = OB_SUCCESS;
+  const int64_t cnt = versioned_tablet_ids_.count();
+  if (cnt > 0 && versioned_tablet_ids_.at(cnt - 1) == tablet_id) {
+    bret = false;
+  } else if (has_exist_in_array(versioned_tablet_ids_, tablet_id)) {
+    bret = false;
+  } else if (OB_FAIL(versioned_tablet_ids_.push_back(tablet_id))) {
+    // advance it again for the following rows, which is harmless
+    TRANS_LOG(WARN, "push back versioned tablet failed", K(ret), K(tablet_id));
+  }
+  return bret;
+}
+
+void ObTransCallbackMgr::inc_lazy_callback_tablets_data_version_()
+{
+  int ret = OB_SUCCESS;
+  transaction::ObPartTransCtx *trans_ctx = NULL;
+  storage::ObLSHandle ls_handle;
+  storage::ObLS *ls = NULL;
+  // skip the tablets advanced by the rows committed in this txn, so that the
+  // tablets are only looked up when all their callbacks are removed early
+  for (int64_t i = lazy_callback_tablet_ids_.count() - 1; i >= 0; --i) {
+    if (has_exist_in_array(versioned_tablet_ids_, lazy_callback_tablet_ids_.at(i))) {
+      (void)lazy_callback_tablet_ids_.remove(i);
+    }
+  }
+  if (lazy_callback_tablet_ids_.empty()) {
+    // do nothing
+  } else if (OB_ISNULL(trans_ctx = get_trans_ctx())) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(WARN, "trans ctx is null", K(ret));
+  } else if (OB_FAIL(MTL(storage::ObLSService *)->get_ls(trans_ctx->get_ls_id(),
+                                                         ls_handle,
+                                                         storage::ObLSGetMod::TRANS_MOD))) {
+    TRANS_LOG(WARN, "get ls failed", K(ret), K(trans_ctx->get_ls_id()));
+  } else if (OB_ISNULL(ls = ls_handle.get_ls())) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(WARN, "ls is null", K(ret), K(trans_ctx->get_ls_id()));
+  } else {
+    // the rows are committed through the tx data, which is filled before the
+    // callbacks are committed, so readers see the data before the new version
+    for (int64_t i = 0; i < lazy_callback_tablet_ids_.count(); ++i) {
+      int tmp_ret = OB_SUCCESS;
+      storage::ObTabletHandle tablet_handle;
+      storage::ObIMemtableMgr *memtable_mgr = NULL;
+      if (OB_TMP_FAIL(ls->get_tablet_svr()->get_tablet(lazy_callback_tablet_ids_.at(i),
+                                                       tablet_handle,
+                                                       storage::ObTabletCommon::NO_CHECK_GET_TABLET_TIMEOUT_US))) {
+        // the tablet is removed
+        TRANS_LOG(DEBUG, "get tablet failed", K(tmp_ret), K(lazy_callback_tablet_ids_.at(i)));
+      } else if (OB_ISNULL(memtable_mgr = tablet_handle.get_obj()->get_memtable_mgr())) {
+      } else {
+        memtable_mgr->inc_data_version();
+      }
+    }
+  }
+  lazy_callback_tablet_ids_.reset();
+}
+
 int ObTransCallbackMgr::clean_unlog_callbacks(int64_t &removed_cnt)
 {
   int ret = OB_SUCCESS;
@@ -583,6 +662,10 @@ int ObTransCallbackMgr::trans_end(const bool commit)
     ret = callback_list_.tx_abort();
   }
   if (OB_SUCC(ret)) {
+    if (commit) {
+      inc_lazy_callback_tablets_data_version_();
+    }
+    versioned_tablet_ids_.reset();
     wakeup_waiting_txns_();
   }
   return ret;
@@ -893,6 +976,9 @@ int ObMvccRowCallback::checkpoint_callback()
     TRANS_LOG(ERROR, "checkpoint never called on unsynced callback", KPC(this));
   } else if (OB_FAIL(value_.remove_callback(*this))) {
     TRANS_LOG(ERROR, "remove callback from trans node failed", K(ret), K(*this));
+  } else if (NULL != memtable_
+             && OB_FAIL(ctx_.add_lazy_callback_tablet(memtable_->get_key().tablet_id_))) {
+    TRANS_LOG(WARN, "add lazy callback tablet failed", K(ret), K(*this));
   }
 
   return ret;
@@ -972,6 +1058,9 @@ int ObMvccRowCallback::trans_commit()
         } else if (blocksstable::ObDmlFlag::DF_LOCK == get_dml_flag()) {
           unlink_trans_node();
         } else {
+          if (NULL != memtable_ && ctx_.need_inc_data_version(memtable_->get_key().tablet_id_)) {
+            memtable_->inc_data_version();
+          }
           const int64_t MAX_TRANS_NODE_CNT = 2 * GCONF._ob_elr_fast_freeze_threshold;
           if (value_.total_trans_node_cnt_ > MAX_TRANS_NODE_CNT
               && NULL != memtable_
@@ -188,6 +188,8 @@ public:
       callback_remove_for_rollback_to_count_(0),
       pending_log_size_(0),
       flushed_log_size_(0),
+      lazy_callback_tablet_ids_(),
+      versioned_tablet_ids_(),
       cb_allocator_(cb_allocator)
   {
   }
@@ -210,6 +212,15 @@ public:
   bool is_for_replay() const { return ATOMIC_LOAD(&for_replay_); }
   int remove_callbacks_for_fast_commit(bool &has_remove);
   int remove_callback_for_uncommited_txn(memtable::ObIMemtable *memtable);
+  // Record the tablet of a row callback removed before the txn ends, whose row
+  // is committed lazily, so that the data version of the tablet is advanced
+  // when the txn commits. It is called under the latch of the main callback
+  // list like the removal itself.
+  int add_lazy_callback_tablet(const common::ObTabletID &tablet_id);
+  // The data version of a tablet only needs to be advanced once per txn, as
+  // the rows are visible through the tx data before any callback commits.
+  // Return true for the first committed row of the tablet in the txn.
+  bool need_inc_data_version(const common::ObTabletID &tablet_id);
   int get_memtable_key_arr(transaction::ObMemtableKeyArray &memtable_key_arr);
   void acquire_callback_list();
   void revert_callback_list();
@@ -219,6 +230,7 @@ public:
   common::SpinRWLock& get_rwlock() { return rwlock_; }
 private:
   void wakeup_waiting_txns_();
+  void inc_lazy_callback_tablets_data_version_();
 public:
   int calc_checksum_before_scn(const share::SCN scn,
                                uint64_t &checksum,
@@ -307,6 +319,10 @@ private:
   int64_t pending_log_size_;
   // current flushed log size in leader participant
   int64_t flushed_log_size_;
+  // tablets of the row callbacks removed before the txn ends
+  common::ObSEArray<common::ObTabletID, 1> lazy_callback_tablet_ids_;
+  // tablets whose data version is advanced by this txn
+  common::ObSEArray<common::ObTabletID, 1> versioned_tablet_ids_;
   ObMemtableCtxCbAllocator &cb_allocator_;
 };
 
@@ -101,6 +101,7 @@ ObLockWaitMgr::ObLockWaitMgr()
       deadlocked_sessions_index_(0)
 {
   memset(sequence_, 0, sizeof(sequence_));
+  memset(row_wait_cnt_, 0, sizeof(row_wait_cnt_));
 }
 
 ObLockWaitMgr::~ObLockWaitMgr() {}
@@ -174,6 +175,7 @@ void RowHolderMapper::reset_hash_holder(const ObTabletID &tablet_id,
 void ObLockWaitMgr::run1()
 {
   int64_t last_dump_ts = 0;
+  int64_t last_decay_ts = 0;
   int64_t now = 0;
   lib::set_thread_name("LockWaitMgr");
   while(!has_set_stop() || !is_hash_empty()) {
@@ -185,6 +187,10 @@ void ObLockWaitMgr::run1()
     }
     // dump debug info, and check deadlock enabdle, clear mapper if deadlock is disabled
     now = ObClockGenerator::getCurrentTime();
+    if (now - last_decay_ts > HOT_ROW_DECAY_INTERVAL) {
+      last_decay_ts = now;
+      decay_hot_row_stat_();
+    }
     if (now - last_dump_ts > 5_s) {
       last_dump_ts = now;
       row_holder_mapper_.dump_mapper_info();
@@ -212,7 +218,7 @@ bool ObLockWaitMgr::post_process(bool need_retry, bool& need_wait)
   if (node != nullptr) {
     uint64_t &hold_key = get_thread_hold_key();
     need_wait = false;
-    if (0 != hold_key) {
+    if (0 != hold_key && (need_retry || need_wakeup_on_stmt_end_(hold_key, *node))) {
       wakeup(hold_key);
     }
     if (need_retry) {
@@ -365,6 +371,43 @@ void ObLockWaitMgr::wakeup(uint64_t hash)
   TRANS_LOG(TRACE, "LockWaitMgr.wakeup.done", K(hash));
 }
 
+bool ObLockWaitMgr::need_wakeup_on_stmt_end_(const uint64_t hold_key, const Node &node)
+{
+  bool bool_ret = true;
+  ObTransID holder_tx_id;
+  // The request was waken up from the row and finished the statement. If it
+  // holds the row lock now, the next waiter will fail to lock again after being
+  // waken up. For hot row, rely on the wakeup when the holder releases the row
+  // lock(elr or commit), to avoid retrying the statements of all waiters once
+  // for each update. Row holder is recorded only if deadlock detection is enabled.
+  if (is_rowkey_hash(hold_key)
+      && is_hot_row(hold_key)
+      && OB_SUCCESS == row_holder_mapper_.get_hash_holder(hold_key, holder_tx_id)
+      && holder_tx_id == ObTransID(node.tx_id_)) {
+    bool_ret = false;
+    TRANS_LOG(TRACE, "hot row holder skip wakeup on stmt end", K(hold_key), K(holder_tx_id));
+  }
+  return bool_ret;
+}
+
+void ObLockWaitMgr::decay_hot_row_stat_()
+{
+  int64_t hot_row_bucket_cnt = 0;
+  for (int64_t i = 0; i < LOCK_BUCKET_COUNT; i++) {
+    const int64_t cnt = ATOMIC_LOAD(&row_wait_cnt_[i]);
+    if (cnt > 0) {
+      if (cnt >= HOT_ROW_WAIT_THRESHOLD) {
+        hot_row_bucket_cnt++;
+      }
+      // concurrent increments may be lost, which is acceptable for statistics
+      ATOMIC_STORE(&row_wait_cnt_[i], cnt >> 1);
+    }
+  }
+  if (hot_row_bucket_cnt > 0) {
+    TRANS_LOG(INFO, "LOCK_MGR: hot row detected", K(hot_row_bucket_cnt));
+  }
+}
+
 ObLockWaitMgr::Node* ObLockWaitMgr::next(Node*& iter, Node* target)
 {
   CriticalGuard(get_qs());
@@ -577,6 +620,9 @@ int ObLockWaitMgr::post_lock(const int tmp_ret,
         TRANS_LOG(WARN, "recheck lock fail", K(key), K(holder_tx_id));
       } else if (locked) {
         auto hash = wait_on_row ? row_hash : tx_hash;
+        if (wait_on_row) {
+          inc_row_wait_cnt(row_hash);
+        }
         if (is_remote_sql) {
           delay_header_node_run_ts(hash);
         }
@@ -186,6 +186,10 @@ public:
 public:
   enum { LOCK_BUCKET_COUNT = 16384};
   static const int64_t OB_SESSPAIR_COUNT = 16;
+  // a row is hot if the count of requests blocked on it within one decay
+  // interval exceeds the threshold
+  static const int64_t HOT_ROW_WAIT_THRESHOLD = 64;
+  static const int64_t HOT_ROW_DECAY_INTERVAL = 1000 * 1000;
   typedef ObMemtableKey Key;
   typedef rpc::ObLockWaitNode Node;
   typedef FixedHash2<Node> Hash;
@@ -287,6 +291,10 @@ private:
   bool wait(Node* node);
   Node* get(uint64_t hash);
   void wakeup(uint64_t hash);
+  // hot row: the holder will wakeup the next waiter when it releases the row
+  // lock, so it is unnecessary to wakeup the next waiter when the statement ends
+  bool need_wakeup_on_stmt_end_(const uint64_t hold_key, const Node &node);
+  void decay_hot_row_stat_();
 private:
 
   static uint64_t& get_thread_hold_key()
@@ -326,11 +334,21 @@ private:
   {
     return ATOMIC_LOAD(&sequence_[(hash >> 1) % LOCK_BUCKET_COUNT]);
   }
+  void inc_row_wait_cnt(uint64_t hash)
+  {
+    ATOMIC_INC(&row_wait_cnt_[(hash >> 1) % LOCK_BUCKET_COUNT]);
+  }
+  bool is_hot_row(uint64_t hash)
+  {
+    return ATOMIC_LOAD(&row_wait_cnt_[(hash >> 1) % LOCK_BUCKET_COUNT]) >= HOT_ROW_WAIT_THRESHOLD;
+  }
 
 private:
   bool is_inited_;
   Hash hash_;
   int64_t sequence_[LOCK_BUCKET_COUNT];
+  // count of requests blocked on the rows in each bucket, decayed periodically
+  int64_t row_wait_cnt_[LOCK_BUCKET_COUNT];
   char hash_buf_[sizeof(SpHashNode) * LOCK_BUCKET_COUNT];
 
 public:
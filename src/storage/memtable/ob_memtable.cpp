@@ -1528,6 +1528,13 @@ int ObMemtable::set_snapshot_version(const SCN snapshot_version)
   return ret;
 }
 
+void ObMemtable::inc_data_version()
+{
+  if (OB_NOT_NULL(memtable_mgr_)) {
+    memtable_mgr_->inc_data_version();
+  }
+}
+
 int ObMemtable::set_rec_scn(SCN rec_scn)
 {
   int ret = OB_SUCCESS;
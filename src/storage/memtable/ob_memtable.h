@@ -399,6 +399,8 @@ public:
   int resolve_snapshot_version_();
   int resolve_max_end_scn_();
   share::SCN get_max_end_scn() const { return max_end_scn_.atomic_get(); }
+  // advance the data version of the tablet after rows are committed
+  void inc_data_version();
   int set_rec_scn(share::SCN rec_scn);
   int set_start_scn(const share::SCN start_ts);
   int set_end_scn(const share::SCN freeze_ts);
@@ -15,6 +15,7 @@
 
 #include "lib/lock/ob_spin_rwlock.h"
 #include "lib/lock/ob_qsync_lock.h"
+#include "lib/time/ob_time_utility.h"
 #include "storage/ob_i_table.h"
 #include "storage/memtable/ob_multi_source_data.h"
 
@@ -202,6 +203,7 @@ public:
       memtable_head_(0),
       memtable_tail_(0),
       t3m_(nullptr),
+      data_version_(common::ObTimeUtility::current_time()),
       lock_(lock_type, lock)
   {
     memset(tables_, 0, sizeof(tables_));
@@ -269,6 +271,12 @@ public:
   OB_INLINE int64_t dec_ref() { return ATOMIC_SAF(&ref_cnt_, 1 /* just sub 1 */); }
   OB_INLINE int64_t get_ref() const { return ATOMIC_LOAD(&ref_cnt_); }
   OB_INLINE void inc_ref() { ATOMIC_INC(&ref_cnt_); }
+  // Data version of the tablet, advanced after every change of the visible data:
+  // commit of the rows in memtables (including the ones committed lazily after
+  // fast commit) and direct load of sstables. It starts from the creation time
+  // so that versions are not repeated by the manager of a recreated tablet.
+  OB_INLINE int64_t get_data_version() const { return ATOMIC_LOAD(&data_version_); }
+  OB_INLINE void inc_data_version() { ATOMIC_INC(&data_version_); }
   OB_INLINE void reset()
   {
     destroy();
@@ -322,6 +330,7 @@ protected:
   int64_t memtable_head_;
   int64_t memtable_tail_;
   ObTenantMetaMemMgr *t3m_;
+  int64_t data_version_;
   memtable::ObIMemtable *tables_[MAX_MEMSTORE_CNT];
   mutable MemtableMgrLock lock_;
 };
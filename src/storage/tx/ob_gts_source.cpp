@@ -41,6 +41,7 @@ void ObGtsStatistics::reset()
   try_get_gts_with_stc_cnt_ = 0;
   wait_gts_elapse_cnt_ = 0;
   try_wait_gts_elapse_cnt_ = 0;
+  coalesced_gts_rpc_cnt_ = 0;
 }
 
 int ObGtsStatistics::init(const uint64_t tenant_id)
@@ -59,9 +60,16 @@ void ObGtsStatistics::statistics()
   const int64_t last_stat_ts = ATOMIC_LOAD(&last_stat_ts_);
   if (cur_ts - last_stat_ts >= STAT_INTERVAL) {
     if (ATOMIC_BCAS(&last_stat_ts_, last_stat_ts, cur_ts)) {
+      const int64_t gts_rpc_cnt = ATOMIC_LOAD(&gts_rpc_cnt_);
+      const int64_t coalesced_gts_rpc_cnt = ATOMIC_LOAD(&coalesced_gts_rpc_cnt_);
+      // average count of gts requests served by one rpc
+      const double gts_rpc_batch_factor = (gts_rpc_cnt <= 0 ? 0 :
+          static_cast<double>(gts_rpc_cnt + coalesced_gts_rpc_cnt) / static_cast<double>(gts_rpc_cnt));
       TRANS_LOG(INFO, "gts statistics",
                       K_(tenant_id),
-                      "gts_rpc_cnt", ATOMIC_LOAD(&gts_rpc_cnt_),
+                      "gts_rpc_cnt", gts_rpc_cnt,
+                      "coalesced_gts_rpc_cnt", coalesced_gts_rpc_cnt,
+                      K(gts_rpc_batch_factor),
                       "get_gts_cache_cnt", ATOMIC_LOAD(&get_gts_cache_cnt_),
                       "get_gts_with_stc_cnt", ATOMIC_LOAD(&get_gts_with_stc_cnt_),
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
@@ -75,6 +83,7 @@ void ObGtsStatistics::statistics()
       ATOMIC_STORE(&try_get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&wait_gts_elapse_cnt_, 0);
       ATOMIC_STORE(&try_wait_gts_elapse_cnt_, 0);
+      ATOMIC_STORE(&coalesced_gts_rpc_cnt_, 0);
     }
   }
 
@@ -93,6 +102,9 @@ void ObGtsSource::reset()
     queue_[i].reset();
   }
   gts_cache_leader_.reset();
+  gts_rpc_rt_ = 0;
+  inflight_srr_ = 0;
+  has_deferred_query_ = false;
 }
 
 
@@ -245,7 +257,7 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
     } else {
       // If not in local, refresh gts
       if (need_send_rpc) {
-        if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
+        if (OB_SUCCESS != (tmp_ret = query_gts_coalesced_(leader))) {
           TRANS_LOG(WARN, "query gts fail", K(tmp_ret), K(leader));
         }
       }
@@ -560,12 +572,62 @@ int ObGtsSource::query_gts_(const ObAddr &leader)
     TRANS_LOG(WARN, "post gts request failed", KR(ret), K(leader), K(msg));
     (void)refresh_gts_location_();
   } else {
+    (void)inc_update(&inflight_srr_, srr.mts_);
     gts_statistics_.inc_gts_rpc_cnt();
     TRANS_LOG(DEBUG, "post gts request success", K(srr), K_(gts_local_cache));
   }
   return ret;
 }
 
+bool ObGtsSource::need_defer_query_gts_(const MonotonicTs now) const
+{
+  const int64_t inflight_srr = ATOMIC_LOAD(&inflight_srr_);
+  const int64_t srr = gts_local_cache_.get_srr().mts_;
+  const int64_t window = std::min(MAX_GTS_COALESCE_WINDOW_US,
+                                  std::max(MIN_GTS_COALESCE_WINDOW_US, 2 * ATOMIC_LOAD(&gts_rpc_rt_)));
+  // the response of latest rpc has not arrived, and it is not regarded as lost
+  return inflight_srr > srr && now.mts_ - inflight_srr < window;
+}
+
+int ObGtsSource::query_gts_coalesced_(const ObAddr &leader)
+{
+  int ret = OB_SUCCESS;
+  if (need_defer_query_gts_(MonotonicTs::current_time())) {
+    ATOMIC_STORE(&has_deferred_query_, true);
+    gts_statistics_.inc_coalesced_gts_rpc_cnt();
+    // double check, the response may arrive before the flag is set
+    if (gts_local_cache_.get_srr().mts_ >= ATOMIC_LOAD(&inflight_srr_)
+        && ATOMIC_BCAS(&has_deferred_query_, true, false)) {
+      ret = query_gts_(leader);
+    }
+  } else {
+    ret = query_gts_(leader);
+  }
+  return ret;
+}
+
+void ObGtsSource::query_deferred_gts_()
+{
+  // send one rpc for the requests deferred while the rpc was inflight, the
+  // srr of the new rpc is greater than the stc of all of them
+  if (ATOMIC_LOAD(&has_deferred_query_) && ATOMIC_BCAS(&has_deferred_query_, true, false)) {
+    const bool need_refresh_gts_location = false;
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = refresh_gts_(need_refresh_gts_location))) {
+      TRANS_LOG(WARN, "refresh gts for deferred requests failed", K(tmp_ret), K_(tenant_id));
+    }
+  }
+}
+
+void ObGtsSource::update_gts_rpc_rt_(const MonotonicTs srr, const MonotonicTs receive_gts_ts)
+{
+  const int64_t rt = receive_gts_ts.mts_ - srr.mts_;
+  if (rt > 0 && rt < MAX_GTS_COALESCE_WINDOW_US) {
+    const int64_t old_rt = ATOMIC_LOAD(&gts_rpc_rt_);
+    ATOMIC_STORE(&gts_rpc_rt_, (0 == old_rt ? rt : (old_rt * 7 + rt) / 8));
+  }
+}
+
 int ObGtsSource::refresh_gts_location_()
 {
   int ret = OB_SUCCESS;
@@ -624,6 +686,8 @@ int ObGtsSource::update_gts(const MonotonicTs srr,
     TRANS_LOG(WARN, "gts local cache update error", KR(ret), K(srr), K(gts),
               K(receive_gts_ts), K(update));
   } else {
+    update_gts_rpc_rt_(srr, receive_gts_ts);
+    query_deferred_gts_();
     TRANS_LOG(DEBUG, "gts local cache update success", K(srr), K(gts));
   }
 
@@ -687,6 +751,10 @@ int ObGtsSource::handle_gts_err_response(const ObGtsErrResponse &err_msg)
       gts_cache_leader_.reset();
       refresh_gts_location_();
     }
+    // the failed rpc is not inflight any more, do not wait for it
+    if (ATOMIC_BCAS(&inflight_srr_, err_msg.get_srr().mts_, 0)) {
+      query_deferred_gts_();
+    }
   }
   if (EXECUTE_COUNT_PER_SEC(16)) {
     TRANS_LOG(INFO, "handle gts err response", KR(ret), K(err_msg), K(*this));
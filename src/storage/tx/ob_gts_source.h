@@ -51,6 +51,7 @@ public:
   void inc_try_get_gts_with_stc_cnt() { ATOMIC_INC(&try_get_gts_with_stc_cnt_); }
   void inc_wait_gts_elapse_cnt() { ATOMIC_INC(&wait_gts_elapse_cnt_); }
   void inc_try_wait_gts_elapse_cnt() { ATOMIC_INC(&try_wait_gts_elapse_cnt_); }
+  void inc_coalesced_gts_rpc_cnt() { ATOMIC_INC(&coalesced_gts_rpc_cnt_); }
   void statistics();
 private:
   uint64_t tenant_id_;
@@ -64,6 +65,8 @@ private:
 
   int64_t wait_gts_elapse_cnt_;
   int64_t try_wait_gts_elapse_cnt_;
+  // gts requests which are not sent and wait for the response of inflight rpc
+  int64_t coalesced_gts_rpc_cnt_;
 };
 
 class ObGtsSource
@@ -98,6 +101,13 @@ private:
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
   int query_gts_(const common::ObAddr &leader);
+  // Group commit of gts requests: if a gts rpc is inflight and sent recently,
+  // do not send a new rpc, but send one rpc for all deferred requests when the
+  // response arrives. The window adapts to the rpc round trip time.
+  int query_gts_coalesced_(const common::ObAddr &leader);
+  bool need_defer_query_gts_(const MonotonicTs now) const;
+  void query_deferred_gts_();
+  void update_gts_rpc_rt_(const MonotonicTs srr, const MonotonicTs receive_gts_ts);
   void statistics_();
   int get_gts_from_local_timestamp_service_(common::ObAddr &leader,
                                             int64_t &gts,
@@ -109,6 +119,8 @@ public:
   static const int64_t WAIT_GTS_QUEUE_COUNT = 1;
   static const int64_t WAIT_GTS_QUEUE_START_INDEX = GET_GTS_QUEUE_COUNT;
   static const int64_t TOTAL_GTS_QUEUE_COUNT = GET_GTS_QUEUE_COUNT + WAIT_GTS_QUEUE_COUNT;
+  static const int64_t MIN_GTS_COALESCE_WINDOW_US = 100;
+  static const int64_t MAX_GTS_COALESCE_WINDOW_US = 10 * 1000;
 private:
   bool is_inited_;
   int64_t tenant_id_;
@@ -122,6 +134,11 @@ private:
   common::ObTimeInterval log_interval_;
   common::ObAddr gts_cache_leader_;
   common::ObTimeInterval refresh_location_interval_;
+  // moving average of gts rpc round trip time
+  int64_t gts_rpc_rt_;
+  // srr of the latest gts rpc posted successfully, 0 if it failed
+  int64_t inflight_srr_;
+  bool has_deferred_query_;
 };
 
 } // transaction
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "gtest/gtest.h"
+#include "share/ob_define.h"
+#define private public
+#include "logservice/libobcdc/src/ob_obj2str_helper.h"
+#undef private
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+
+TEST(ObObj2strHelper, binary_column_encoding_of_obj_type)
+{
+  EXPECT_EQ(CDC_BINARY_COL_INT64, ObObj2strHelper::get_binary_column_encoding(ObTinyIntType));
+  EXPECT_EQ(CDC_BINARY_COL_INT64, ObObj2strHelper::get_binary_column_encoding(ObIntType));
+  EXPECT_EQ(CDC_BINARY_COL_INT64, ObObj2strHelper::get_binary_column_encoding(ObUInt64Type));
+  EXPECT_EQ(CDC_BINARY_COL_INT64, ObObj2strHelper::get_binary_column_encoding(ObBitType));
+  EXPECT_EQ(CDC_BINARY_COL_INT64, ObObj2strHelper::get_binary_column_encoding(ObEnumType));
+  EXPECT_EQ(CDC_BINARY_COL_INT64, ObObj2strHelper::get_binary_column_encoding(ObSetType));
+  EXPECT_EQ(CDC_BINARY_COL_FLOAT, ObObj2strHelper::get_binary_column_encoding(ObFloatType));
+  EXPECT_EQ(CDC_BINARY_COL_DOUBLE, ObObj2strHelper::get_binary_column_encoding(ObUDoubleType));
+  EXPECT_EQ(CDC_BINARY_COL_DATE, ObObj2strHelper::get_binary_column_encoding(ObDateType));
+  EXPECT_EQ(CDC_BINARY_COL_DATETIME, ObObj2strHelper::get_binary_column_encoding(ObDateTimeType));
+  EXPECT_EQ(CDC_BINARY_COL_DATETIME, ObObj2strHelper::get_binary_column_encoding(ObTimestampType));
+  EXPECT_EQ(CDC_BINARY_COL_TIME, ObObj2strHelper::get_binary_column_encoding(ObTimeType));
+  EXPECT_EQ(CDC_BINARY_COL_YEAR, ObObj2strHelper::get_binary_column_encoding(ObYearType));
+  EXPECT_EQ(CDC_BINARY_COL_BYTES, ObObj2strHelper::get_binary_column_encoding(ObVarcharType));
+  EXPECT_EQ(CDC_BINARY_COL_BYTES, ObObj2strHelper::get_binary_column_encoding(ObLongTextType));
+  EXPECT_EQ(CDC_BINARY_COL_TEXT, ObObj2strHelper::get_binary_column_encoding(ObNumberType));
+  EXPECT_EQ(CDC_BINARY_COL_TEXT, ObObj2strHelper::get_binary_column_encoding(ObJsonType));
+  EXPECT_EQ(CDC_BINARY_COL_TEXT, ObObj2strHelper::get_binary_column_encoding(ObGeometryType));
+  EXPECT_EQ(CDC_BINARY_COL_TEXT, ObObj2strHelper::get_binary_column_encoding(ObTimestampTZType));
+  EXPECT_EQ(CDC_BINARY_COL_TEXT, ObObj2strHelper::get_binary_column_encoding(ObExtendType));
+}
+
+class TestObCDCBinaryRow : public ::testing::Test
+{
+public:
+  TestObCDCBinaryRow() : allocator_("TestBinaryRow") {}
+  virtual void SetUp() {}
+  virtual void TearDown() { allocator_.clear(); }
+
+  // convert obj to binary and check the encoded bytes are the native value of expected length
+  void check_binary(const ObObj &obj, const void *expect_value, const int64_t expect_len)
+  {
+    ObString str;
+    bool is_converted = false;
+
+    // zero copy
+    EXPECT_EQ(OB_SUCCESS, helper_.convert_obj_to_binary_(obj, str, allocator_, false, is_converted));
+    EXPECT_TRUE(is_converted) << "obj=" << to_cstring(obj);
+    EXPECT_EQ(expect_len, str.length()) << "obj=" << to_cstring(obj);
+    EXPECT_EQ(obj.get_data_ptr(), static_cast<const void *>(str.ptr())) << "obj=" << to_cstring(obj);
+    EXPECT_EQ(0, MEMCMP(expect_value, str.ptr(), expect_len)) << "obj=" << to_cstring(obj);
+
+    // deep copy
+    str.reset();
+    is_converted = false;
+    EXPECT_EQ(OB_SUCCESS, helper_.convert_obj_to_binary_(obj, str, allocator_, true, is_converted));
+    EXPECT_TRUE(is_converted) << "obj=" << to_cstring(obj);
+    EXPECT_EQ(expect_len, str.length()) << "obj=" << to_cstring(obj);
+    EXPECT_NE(obj.get_data_ptr(), static_cast<const void *>(str.ptr())) << "obj=" << to_cstring(obj);
+    EXPECT_EQ(0, MEMCMP(expect_value, str.ptr(), expect_len)) << "obj=" << to_cstring(obj);
+  }
+
+  // obj is left to text conversion
+  void check_not_binary(const ObObj &obj)
+  {
+    ObString str;
+    bool is_converted = true;
+
+    EXPECT_EQ(OB_SUCCESS, helper_.convert_obj_to_binary_(obj, str, allocator_, false, is_converted));
+    EXPECT_FALSE(is_converted) << "obj=" << to_cstring(obj);
+    EXPECT_TRUE(str.empty()) << "obj=" << to_cstring(obj);
+  }
+
+protected:
+  ObObj2strHelper helper_;
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestObCDCBinaryRow, convert_integer)
+{
+  ObObj obj;
+  int64_t int_value = 0;
+  uint64_t uint_value = 0;
+
+  obj.set_tinyint(-7);
+  int_value = -7;
+  check_binary(obj, &int_value, sizeof(int64_t));
+
+  obj.set_int(-1234567890123LL);
+  int_value = -1234567890123LL;
+  check_binary(obj, &int_value, sizeof(int64_t));
+
+  obj.set_uint64(UINT64_MAX - 1);
+  uint_value = UINT64_MAX - 1;
+  check_binary(obj, &uint_value, sizeof(uint64_t));
+
+  obj.set_bit(0x5A5A);
+  uint_value = 0x5A5A;
+  check_binary(obj, &uint_value, sizeof(uint64_t));
+
+  obj.set_enum(3);
+  uint_value = 3;
+  check_binary(obj, &uint_value, sizeof(uint64_t));
+
+  obj.set_set(0x6);
+  uint_value = 0x6;
+  check_binary(obj, &uint_value, sizeof(uint64_t));
+}
+
+TEST_F(TestObCDCBinaryRow, convert_float_and_double)
+{
+  ObObj obj;
+  float float_value = -3.25f;
+  double double_value = 1234.5678;
+
+  obj.set_float(float_value);
+  check_binary(obj, &float_value, sizeof(float));
+
+  obj.set_double(double_value);
+  check_binary(obj, &double_value, sizeof(double));
+
+  obj.set_udouble(double_value);
+  check_binary(obj, &double_value, sizeof(double));
+}
+
+TEST_F(TestObCDCBinaryRow, convert_temporal)
+{
+  ObObj obj;
+  // days since 1970-01-01
+  int32_t date_value = 19000;
+  // microseconds
+  int64_t datetime_value = 1641024000123456LL;
+  int64_t time_value = 3723000000LL;
+  uint8_t year_value = 122;
+
+  obj.set_date(date_value);
+  check_binary(obj, &date_value, sizeof(int32_t));
+
+  obj.set_datetime(datetime_value);
+  check_binary(obj, &datetime_value, sizeof(int64_t));
+
+  obj.set_timestamp(datetime_value);
+  check_binary(obj, &datetime_value, sizeof(int64_t));
+
+  obj.set_time(time_value);
+  check_binary(obj, &time_value, sizeof(int64_t));
+
+  obj.set_year(year_value);
+  check_binary(obj, &year_value, sizeof(uint8_t));
+}
+
+TEST_F(TestObCDCBinaryRow, not_convert_text_and_bytes)
+{
+  ObObj obj;
+  number::ObNumber nmb;
+
+  obj.set_varchar("binary_row");
+  check_not_binary(obj);
+
+  obj.set_varbinary("\x01\x02\x03");
+  check_not_binary(obj);
+
+  ASSERT_EQ(OB_SUCCESS, nmb.from("3.1415926", allocator_));
+  obj.set_number(nmb);
+  check_not_binary(obj);
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_cdc_binary_row.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
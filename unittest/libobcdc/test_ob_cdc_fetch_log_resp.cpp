@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "gtest/gtest.h"
+#include "share/ob_define.h"
+#include "lib/allocator/ob_malloc.h"
+#include "logservice/cdcservice/ob_cdc_req.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace obrpc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+
+static void fill_resp(ObCdcLSFetchLogResp &resp, const int64_t log_cnt, const int64_t log_size)
+{
+  resp.set_ls_id(share::ObLSID(1001));
+  resp.set_err(OB_SUCCESS);
+  for (int64_t i = 0; i < log_cnt; i++) {
+    int64_t remain_size = 0;
+    char *buf = resp.get_remain_buf(remain_size);
+    ASSERT_TRUE(remain_size >= log_size);
+    for (int64_t j = 0; j < log_size; j++) {
+      buf[j] = static_cast<char>('a' + (j % 8));
+    }
+    resp.log_entry_filled(log_size);
+  }
+}
+
+static void serialize_and_assign(const ObCdcLSFetchLogResp &src, ObCdcLSFetchLogResp &dst)
+{
+  ObCdcLSFetchLogResp *wire = new ObCdcLSFetchLogResp();
+  const int64_t buf_len = src.get_serialize_size();
+  char *buf = static_cast<char *>(ob_malloc(buf_len, "TestCdcResp"));
+  int64_t pos = 0;
+  ASSERT_TRUE(NULL != buf);
+  ASSERT_EQ(OB_SUCCESS, src.serialize(buf, buf_len, pos));
+  ASSERT_EQ(buf_len, pos);
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, wire->deserialize(buf, buf_len, pos));
+  ASSERT_EQ(src.is_compressed(), wire->is_compressed());
+  ASSERT_EQ(OB_SUCCESS, dst.assign(*wire));
+  ob_free(buf);
+  delete wire;
+}
+
+TEST(ObCdcLSFetchLogResp, compress_round_trip)
+{
+  const ObCompressorType types[] = {LZ4_COMPRESSOR, ZSTD_1_3_8_COMPRESSOR};
+  for (int64_t i = 0; i < ARRAYSIZEOF(types); i++) {
+    ObCdcLSFetchLogResp *resp = new ObCdcLSFetchLogResp();
+    ObCdcLSFetchLogResp *result = new ObCdcLSFetchLogResp();
+    fill_resp(*resp, 100, 4096);
+    const int64_t raw_len = resp->get_pos();
+
+    ASSERT_EQ(OB_SUCCESS, resp->compress_payload(types[i]));
+    ASSERT_TRUE(resp->is_compressed());
+    ASSERT_EQ(types[i], resp->get_compressor_type());
+    ASSERT_EQ(raw_len, resp->get_raw_data_len());
+    ASSERT_LT(resp->get_pos(), raw_len);
+
+    serialize_and_assign(*resp, *result);
+    ASSERT_FALSE(result->is_compressed());
+    ASSERT_EQ(raw_len, result->get_pos());
+    ASSERT_EQ(100, result->get_log_num());
+    for (int64_t j = 0; j < raw_len; j++) {
+      ASSERT_EQ(static_cast<char>('a' + ((j % 4096) % 8)), result->get_log_entry_buf()[j]);
+    }
+    delete resp;
+    delete result;
+  }
+}
+
+TEST(ObCdcLSFetchLogResp, no_compress)
+{
+  ObCdcLSFetchLogResp *resp = new ObCdcLSFetchLogResp();
+  ObCdcLSFetchLogResp *result = new ObCdcLSFetchLogResp();
+
+  // empty payload is never compressed
+  ASSERT_EQ(OB_SUCCESS, resp->compress_payload(LZ4_COMPRESSOR));
+  ASSERT_FALSE(resp->is_compressed());
+
+  // compressor not negotiated
+  fill_resp(*resp, 10, 1024);
+  ASSERT_EQ(OB_SUCCESS, resp->compress_payload(INVALID_COMPRESSOR));
+  ASSERT_FALSE(resp->is_compressed());
+  ASSERT_EQ(OB_SUCCESS, resp->compress_payload(NONE_COMPRESSOR));
+  ASSERT_FALSE(resp->is_compressed());
+
+  serialize_and_assign(*resp, *result);
+  ASSERT_EQ(resp->get_pos(), result->get_pos());
+  ASSERT_EQ(0, MEMCMP(resp->get_log_entry_buf(), result->get_log_entry_buf(), resp->get_pos()));
+
+  delete resp;
+  delete result;
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_cdc_fetch_log_resp.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "observer/omt/ob_th_worker.h"
+#include "observer/omt/ob_tenant.h"
+#undef private
+#undef protected
+#include "share/config/ob_server_config.h"
+#include "share/resource_manager/ob_cgroup_ctrl.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::omt;
+using namespace oceanbase::share;
+
+class TestWorkerTokenHandoff
+    : public ::testing::Test
+{
+public:
+  TestWorkerTokenHandoff()
+      : tenant_(TENANT_ID, TIMES_OF_WORKERS, cgroup_ctrl_)
+  {}
+
+  virtual void SetUp()
+  {
+    GCONF._enable_blocking_worker_handoff.set_value("True");
+    tenant_.unit_max_cpu_ = 4;
+    tenant_.token_cnt_ = 4;
+    // enough workers are assigned already, blocking never acquires new ones here
+    tenant_.ass_token_cnt_ = tenant_.worker_count_bound();
+    worker_.tenant_ = &tenant_;
+    worker_.set_worker_level(0);
+    worker_.set_req_flag(true);
+  }
+
+  virtual void TearDown()
+  {
+    worker_.set_req_flag(false);
+    worker_.tenant_ = nullptr;
+    GCONF._enable_blocking_worker_handoff.set_value("False");
+  }
+
+  int64_t blocking_workers() const { return tenant_.blocking_workers_; }
+
+protected:
+  static const int64_t TENANT_ID = 1001;
+  static const int64_t TIMES_OF_WORKERS = 10;
+  ObCgroupCtrl cgroup_ctrl_;
+  ObTenant tenant_;
+  ObThWorker worker_;
+};
+
+TEST_F(TestWorkerTokenHandoff, hand_over_once_per_blocking_section)
+{
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(worker_.sched_wait());
+    EXPECT_EQ(1, blocking_workers());
+    EXPECT_EQ(5, tenant_.effective_token_cnt());
+    // nested waits, e.g. an io wait inside a rpc wait, hand over nothing more
+    EXPECT_TRUE(worker_.sched_wait());
+    EXPECT_EQ(1, blocking_workers());
+    worker_.sched_run();
+    EXPECT_EQ(0, blocking_workers());
+    EXPECT_EQ(4, tenant_.effective_token_cnt());
+    // the outer sched_run of nested waits takes nothing back twice
+    worker_.sched_run();
+    EXPECT_EQ(0, blocking_workers());
+  }
+}
+
+TEST_F(TestWorkerTokenHandoff, sched_run_without_wait)
+{
+  // sched_run is also called on its own, e.g. by the autoinc lock retry loop
+  worker_.sched_run();
+  EXPECT_EQ(0, blocking_workers());
+  EXPECT_EQ(4, tenant_.effective_token_cnt());
+}
+
+TEST_F(TestWorkerTokenHandoff, take_back_at_request_end)
+{
+  // a blocking section left without sched_run on an error path, the token is
+  // taken back at the end of the request, and only once
+  EXPECT_TRUE(worker_.sched_wait());
+  EXPECT_EQ(1, blocking_workers());
+  worker_.end_blocking();
+  EXPECT_EQ(0, blocking_workers());
+  worker_.end_blocking();
+  worker_.sched_run();
+  EXPECT_EQ(0, blocking_workers());
+
+  // the next request hands over again
+  EXPECT_TRUE(worker_.sched_wait());
+  EXPECT_EQ(1, blocking_workers());
+  worker_.sched_run();
+  EXPECT_EQ(0, blocking_workers());
+}
+
+TEST_F(TestWorkerTokenHandoff, no_handover_out_of_tenant_requests)
+{
+  // disabled
+  GCONF._enable_blocking_worker_handoff.set_value("False");
+  EXPECT_TRUE(worker_.sched_wait());
+  EXPECT_EQ(0, blocking_workers());
+  worker_.sched_run();
+  EXPECT_EQ(0, blocking_workers());
+  GCONF._enable_blocking_worker_handoff.set_value("True");
+
+  // not processing a request
+  worker_.set_req_flag(false);
+  EXPECT_TRUE(worker_.sched_wait());
+  EXPECT_EQ(0, blocking_workers());
+  worker_.sched_run();
+  worker_.set_req_flag(true);
+
+  // nesting worker, counted by its own level
+  worker_.set_worker_level(1);
+  EXPECT_TRUE(worker_.sched_wait());
+  EXPECT_EQ(0, blocking_workers());
+  worker_.sched_run();
+  worker_.set_worker_level(0);
+  EXPECT_EQ(0, blocking_workers());
+}
+
+TEST_F(TestWorkerTokenHandoff, bounded_by_worker_count)
+{
+  const int64_t bound = tenant_.worker_count_bound();
+  tenant_.blocking_workers_ = bound;
+  EXPECT_EQ(bound, tenant_.effective_token_cnt());
+  tenant_.blocking_workers_ = 0;
+  EXPECT_EQ(tenant_.token_cnt_, tenant_.effective_token_cnt());
+}
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/aggregate/ob_exec_hash_struct.h"
+#undef private
+#include "lib/allocator/ob_malloc.h"
+#include "lib/hash_func/murmur_hash.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+struct TestItem
+{
+  TestItem() : id_(0) {}
+  int64_t id_;
+};
+
+typedef ObInlineKeyHashTable<TestItem, 2> HashTable;
+
+class TestInlineKeyHashTable : public ::testing::Test
+{
+public:
+  TestInlineKeyHashTable() : attr_(OB_SYS_TENANT_ID, "InlineKeyHT") {}
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, ht_.init(&allocator_, attr_, 16));
+  }
+  virtual void TearDown() { ht_.destroy(); }
+
+  static HashTable::Key make_key(const uint64_t v0, const uint64_t v1,
+                                 const uint64_t null_bits = 0)
+  {
+    HashTable::Key key;
+    MEMSET(&key, 0, sizeof(key));
+    key.values_[0] = v0;
+    key.values_[1] = v1;
+    key.null_bits_ = null_bits;
+    return key;
+  }
+  static uint64_t hash(const uint64_t v) { return murmurhash(&v, sizeof(v), 0); }
+
+protected:
+  ObMalloc allocator_;
+  lib::ObMemAttr attr_;
+  HashTable ht_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestInlineKeyHashTable);
+};
+
+TEST_F(TestInlineKeyHashTable, init)
+{
+  HashTable ht;
+  ASSERT_FALSE(ht.is_inited());
+  ASSERT_EQ(NULL, ht.get(1, make_key(1, 1)));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ht.init(&allocator_, attr_, 1));
+  ASSERT_EQ(OB_SUCCESS, ht.init(&allocator_, attr_, 2));
+  ASSERT_TRUE(ht.is_inited());
+  // at least one probe group
+  ASSERT_EQ(HashTable::GROUP_SIZE, ht.get_bucket_num());
+  ASSERT_EQ(0U, reinterpret_cast<uint64_t>(ht.ctrls_) % HashTable::GROUP_SIZE);
+
+  // buckets are scaled and rounded up to power of 2
+  ASSERT_EQ(32, ht_.get_bucket_num());
+  ASSERT_EQ(0, ht_.size());
+}
+
+TEST_F(TestInlineKeyHashTable, insert_and_lookup)
+{
+  const int64_t CNT = 20;
+  TestItem items[CNT];
+  for (int64_t i = 0; i < CNT; i++) {
+    items[i].id_ = i;
+    ASSERT_EQ(OB_SUCCESS, ht_.set(hash(i), make_key(i, i * 10), items[i]));
+  }
+  ASSERT_EQ(CNT, ht_.size());
+  for (int64_t i = 0; i < CNT; i++) {
+    const TestItem *item = ht_.get(hash(i), make_key(i, i * 10));
+    ASSERT_EQ(&items[i], item);
+  }
+  // same hash value, different key
+  ASSERT_EQ(NULL, ht_.get(hash(0), make_key(0, 1)));
+  // same values, different null bits
+  ASSERT_EQ(NULL, ht_.get(hash(0), make_key(0, 0, 1)));
+  // absent key
+  ASSERT_EQ(NULL, ht_.get(hash(CNT), make_key(CNT, CNT * 10)));
+
+  // key already exist
+  TestItem dup;
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ht_.set(hash(0), make_key(0, 0), dup));
+  ASSERT_EQ(CNT, ht_.size());
+  ASSERT_EQ(&items[0], ht_.get(hash(0), make_key(0, 0)));
+}
+
+TEST_F(TestInlineKeyHashTable, null_key)
+{
+  TestItem items[3];
+  // (NULL, 0), (0, NULL), (NULL, NULL) share the same values
+  ASSERT_EQ(OB_SUCCESS, ht_.set(hash(0), make_key(0, 0, 1), items[0]));
+  ASSERT_EQ(OB_SUCCESS, ht_.set(hash(0), make_key(0, 0, 2), items[1]));
+  ASSERT_EQ(OB_SUCCESS, ht_.set(hash(0), make_key(0, 0, 3), items[2]));
+  ASSERT_EQ(&items[0], ht_.get(hash(0), make_key(0, 0, 1)));
+  ASSERT_EQ(&items[1], ht_.get(hash(0), make_key(0, 0, 2)));
+  ASSERT_EQ(&items[2], ht_.get(hash(0), make_key(0, 0, 3)));
+  ASSERT_EQ(NULL, ht_.get(hash(0), make_key(0, 0, 0)));
+}
+
+TEST_F(TestInlineKeyHashTable, grow)
+{
+  const int64_t CNT = 10000;
+  TestItem *items = new TestItem[CNT];
+  int64_t pre_bucket_num = ht_.get_bucket_num();
+  int64_t extend_cnt = 0;
+  for (int64_t i = 0; i < CNT; i++) {
+    items[i].id_ = i;
+    ASSERT_EQ(OB_SUCCESS, ht_.set(hash(i), make_key(i, CNT - i), items[i]));
+    if (ht_.get_bucket_num() != pre_bucket_num) {
+      ASSERT_EQ(pre_bucket_num * 2, ht_.get_bucket_num());
+      pre_bucket_num = ht_.get_bucket_num();
+      extend_cnt++;
+    }
+    // never filled more than 7/8, so the probe always ends at an empty slot
+    ASSERT_LE(ht_.size() * 8, ht_.get_bucket_num() * 7);
+  }
+  ASSERT_GT(extend_cnt, 0);
+  ASSERT_EQ(CNT, ht_.size());
+  ASSERT_EQ(ht_.mem_used(), HashTable::alloc_size(ht_.get_bucket_num()));
+  // all items are still reachable after rehash
+  for (int64_t i = 0; i < CNT; i++) {
+    ASSERT_EQ(&items[i], ht_.get(hash(i), make_key(i, CNT - i)));
+  }
+
+  int64_t visited = 0;
+  int64_t id_sum = 0;
+  auto cb = [&](TestItem &item) {
+    visited++;
+    id_sum += item.id_;
+    return OB_SUCCESS;
+  };
+  ASSERT_EQ(OB_SUCCESS, ht_.foreach(cb));
+  ASSERT_EQ(CNT, visited);
+  ASSERT_EQ(CNT * (CNT - 1) / 2, id_sum);
+
+  // reuse keeps buckets, resize to small shrinks them
+  const int64_t bucket_num = ht_.get_bucket_num();
+  ht_.reuse();
+  ASSERT_EQ(0, ht_.size());
+  ASSERT_EQ(bucket_num, ht_.get_bucket_num());
+  ASSERT_EQ(NULL, ht_.get(hash(0), make_key(0, CNT)));
+  ASSERT_EQ(OB_SUCCESS, ht_.resize(&allocator_, 16));
+  ASSERT_EQ(32, ht_.get_bucket_num());
+  ASSERT_EQ(OB_SUCCESS, ht_.set(hash(0), make_key(0, CNT), items[0]));
+  ASSERT_EQ(&items[0], ht_.get(hash(0), make_key(0, CNT)));
+  delete [] items;
+}
+
+TEST_F(TestInlineKeyHashTable, collision_chain)
+{
+  // All hash values locate the first group with the same control byte, so the
+  // keys are told apart by key comparison and the probe overflows to the next groups.
+  const int64_t CNT = 40;
+  TestItem items[CNT];
+  const uint64_t hash_val = 0x5A;
+  ASSERT_EQ(0U, (hash_val >> HashTable::H2_BITS) & ht_.group_mask_);
+  for (int64_t i = 0; i < CNT; i++) {
+    items[i].id_ = i;
+    ASSERT_EQ(OB_SUCCESS, ht_.set(hash_val, make_key(i, 0), items[i]));
+  }
+  ASSERT_EQ(CNT, ht_.size());
+  ASSERT_GT(ht_.get_bucket_num(), 32);
+  for (int64_t i = 0; i < CNT; i++) {
+    ASSERT_EQ(&items[i], ht_.get(hash_val, make_key(i, 0)));
+  }
+  ASSERT_EQ(NULL, ht_.get(hash_val, make_key(CNT, 0)));
+
+  // Different hash values sharing the same control byte and group
+  HashTable ht;
+  ASSERT_EQ(OB_SUCCESS, ht.init(&allocator_, attr_, 64));
+  const int64_t group_bits = HashTable::H2_BITS
+      + static_cast<int64_t>(__builtin_ctzll(ht.group_mask_ + 1));
+  for (int64_t i = 0; i < CNT; i++) {
+    const uint64_t h = hash_val | (static_cast<uint64_t>(i + 1) << group_bits);
+    ASSERT_EQ(OB_SUCCESS, ht.set(h, make_key(0, 0), items[i]));
+  }
+  ASSERT_EQ(CNT, ht.size());
+  for (int64_t i = 0; i < CNT; i++) {
+    const uint64_t h = hash_val | (static_cast<uint64_t>(i + 1) << group_bits);
+    ASSERT_EQ(&items[i], ht.get(h, make_key(0, 0)));
+  }
+  ASSERT_EQ(NULL, ht.get(hash_val, make_key(0, 0)));
+}
+
+TEST_F(TestInlineKeyHashTable, match_group)
+{
+  alignas(16) uint8_t group[HashTable::GROUP_SIZE];
+  MEMSET(group, HashTable::EMPTY, sizeof(group));
+  ASSERT_EQ(0xFFFFu, HashTable::match_group(group, HashTable::EMPTY));
+  group[0] = 1;
+  group[5] = 1;
+  group[15] = 0x7F;
+  ASSERT_EQ((1u << 0) | (1u << 5), HashTable::match_group(group, 1));
+  ASSERT_EQ(1u << 15, HashTable::match_group(group, 0x7F));
+  ASSERT_EQ(0u, HashTable::match_group(group, 2));
+  ASSERT_EQ(0xFFFFu & ~((1u << 0) | (1u << 5) | (1u << 15)),
+            HashTable::match_group(group, HashTable::EMPTY));
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
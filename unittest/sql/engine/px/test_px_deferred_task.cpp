@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "sql/engine/px/ob_px_sub_coord.h"
+#include "sql/engine/px/ob_px_sqc_handler.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+static const int64_t TASK_COUNT = 8;
+static const int64_t START_TASK_COUNT = 2;
+
+class ObPxDeferredTaskTest : public ::testing::Test
+{
+public:
+  ObPxDeferredTaskTest() = default;
+  virtual ~ObPxDeferredTaskTest() = default;
+  virtual void SetUp() { tasks_.init(TASK_COUNT); }
+  virtual void TearDown() {}
+
+protected:
+  ObPxDeferredTaskSet tasks_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObPxDeferredTaskTest);
+};
+
+TEST_F(ObPxDeferredTaskTest, deferred_start)
+{
+  int64_t task_idx = -1;
+  int64_t start_idx = -1;
+  int64_t end_idx = -1;
+  int skip_ret = OB_ERR_UNEXPECTED;
+  // nothing is claimed before the first tasks are dispatched
+  ASSERT_FALSE(tasks_.has_unclaimed());
+  ASSERT_FALSE(tasks_.try_claim_one(task_idx));
+
+  tasks_.open(START_TASK_COUNT, start_idx, end_idx, skip_ret);
+  ASSERT_EQ(start_idx, end_idx);
+  ASSERT_EQ(OB_SUCCESS, skip_ret);
+  ASSERT_TRUE(tasks_.has_unclaimed());
+  ASSERT_EQ(START_TASK_COUNT, tasks_.get_next_task_idx());
+
+  // grow one by one
+  ASSERT_TRUE(tasks_.try_claim_one(task_idx));
+  ASSERT_EQ(START_TASK_COUNT, task_idx);
+  ASSERT_TRUE(tasks_.try_claim_one(task_idx));
+  ASSERT_EQ(START_TASK_COUNT + 1, task_idx);
+
+  // the exiting worker starts the rest
+  tasks_.claim_all(OB_SUCCESS, start_idx, end_idx);
+  ASSERT_EQ(START_TASK_COUNT + 2, start_idx);
+  ASSERT_EQ(TASK_COUNT, end_idx);
+  ASSERT_FALSE(tasks_.has_unclaimed());
+  ASSERT_FALSE(tasks_.try_claim_one(task_idx));
+  tasks_.claim_all(OB_SUCCESS, start_idx, end_idx);
+  ASSERT_EQ(start_idx, end_idx);
+}
+
+TEST_F(ObPxDeferredTaskTest, skip_on_interrupt)
+{
+  int64_t start_idx = -1;
+  int64_t end_idx = -1;
+  int skip_ret = OB_SUCCESS;
+  // a worker is interrupted and exits before the sqc finished dispatching,
+  // the sqc skips all deferred tasks with the first error
+  tasks_.claim_all(OB_ERR_INTERRUPTED, start_idx, end_idx);
+  ASSERT_EQ(start_idx, end_idx);
+  tasks_.claim_all(OB_TIMEOUT, start_idx, end_idx);
+  ASSERT_EQ(start_idx, end_idx);
+  tasks_.open(START_TASK_COUNT, start_idx, end_idx, skip_ret);
+  ASSERT_EQ(START_TASK_COUNT, start_idx);
+  ASSERT_EQ(TASK_COUNT, end_idx);
+  ASSERT_EQ(OB_ERR_INTERRUPTED, skip_ret);
+  ASSERT_FALSE(tasks_.has_unclaimed());
+
+  // after opened the error is passed by the claimer
+  ObPxDeferredTaskSet tasks;
+  tasks.init(TASK_COUNT);
+  tasks.open(START_TASK_COUNT, start_idx, end_idx, skip_ret);
+  ASSERT_EQ(OB_SUCCESS, skip_ret);
+  tasks.claim_all(OB_ERR_INTERRUPTED, start_idx, end_idx);
+  ASSERT_EQ(START_TASK_COUNT, start_idx);
+  ASSERT_EQ(TASK_COUNT, end_idx);
+}
+
+TEST_F(ObPxDeferredTaskTest, exiting_worker_runs_rest)
+{
+  int64_t task_idx = -1;
+  int64_t start_idx = -1;
+  int64_t end_idx = -1;
+  int skip_ret = OB_ERR_UNEXPECTED;
+  tasks_.open(START_TASK_COUNT, start_idx, end_idx, skip_ret);
+  ASSERT_TRUE(tasks_.try_claim_one(task_idx));
+  // the exiting worker runs the rest one by one in its own thread
+  for (int64_t i = START_TASK_COUNT + 1; i < TASK_COUNT; ++i) {
+    ASSERT_TRUE(tasks_.claim_one(task_idx));
+    ASSERT_EQ(i, task_idx);
+  }
+  ASSERT_FALSE(tasks_.claim_one(task_idx));
+  ASSERT_FALSE(tasks_.has_unclaimed());
+
+  // a worker exiting before the set is opened leaves the rest to the sqc
+  ObPxDeferredTaskSet tasks;
+  tasks.init(TASK_COUNT);
+  ASSERT_FALSE(tasks.claim_one(task_idx));
+  tasks.open(START_TASK_COUNT, start_idx, end_idx, skip_ret);
+  ASSERT_EQ(START_TASK_COUNT, start_idx);
+  ASSERT_EQ(TASK_COUNT, end_idx);
+  ASSERT_EQ(OB_SUCCESS, skip_ret);
+  ASSERT_FALSE(tasks.claim_one(task_idx));
+}
+
+// every task must end exactly once, either dispatched or skipped,
+// for the sqc to see all workers finished.
+TEST_F(ObPxDeferredTaskTest, sqc_finish_accounting)
+{
+  const int64_t THREAD_COUNT = 4;
+  ObPxWorkNotifier notifier;
+  int64_t claimed[TASK_COUNT] = {0};
+  int64_t start_idx = 0;
+  int64_t end_idx = 0;
+  int skip_ret = OB_SUCCESS;
+  ASSERT_EQ(OB_SUCCESS, notifier.set_expect_worker_count(TASK_COUNT));
+  notifier.set_start_wait_count(START_TASK_COUNT);
+  for (int64_t i = 0; i < START_TASK_COUNT; ++i) {
+    claimed[i] = 1;
+    notifier.worker_start(i);
+  }
+  // rpc thread only waits for the first tasks
+  ASSERT_EQ(OB_SUCCESS, notifier.wait_all_worker_start());
+  tasks_.open(START_TASK_COUNT, start_idx, end_idx, skip_ret);
+  ASSERT_EQ(start_idx, end_idx);
+
+  // workers grow the dop concurrently, then all exit
+  std::vector<std::thread> threads;
+  for (int64_t t = 0; t < THREAD_COUNT; ++t) {
+    threads.push_back(std::thread([&, t]() {
+      int64_t task_idx = 0;
+      for (int64_t i = 0; i < 100; ++i) {
+        if (tasks_.try_claim_one(task_idx)) {
+          ATOMIC_INC(&claimed[task_idx]);
+        }
+      }
+      int64_t s = 0;
+      int64_t e = 0;
+      tasks_.claim_all(0 == t % 2 ? OB_SUCCESS : OB_ERR_INTERRUPTED, s, e);
+      for (int64_t idx = s; idx < e; ++idx) {
+        ATOMIC_INC(&claimed[idx]);
+      }
+    }));
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+  ASSERT_FALSE(tasks_.has_unclaimed());
+  bool all_finish = false;
+  for (int64_t i = 0; i < TASK_COUNT; ++i) {
+    ASSERT_EQ(1, claimed[i]);
+    notifier.worker_end(all_finish);
+    ASSERT_FALSE(all_finish);
+  }
+  // the rpc thread is the last one
+  notifier.worker_end(all_finish);
+  ASSERT_TRUE(all_finish);
+}
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "lib/ob_errno.h"
+#include "common/rowkey/ob_store_rowkey.h"
+#include "share/config/ob_server_config.h"
+#include "storage/memtable/ob_lock_wait_mgr.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+using namespace common;
+using namespace memtable;
+using namespace transaction;
+
+namespace unittest
+{
+
+// records the reposted requests instead of putting them into the worker queue
+class MockLockWaitMgr : public ObLockWaitMgr
+{
+public:
+  virtual int repost(Node *node) override
+  {
+    return reposted_.push_back(node);
+  }
+  ObSEArray<Node *, 4> reposted_;
+};
+
+class TestLockWaitMgr : public ::testing::Test
+{
+public:
+  TestLockWaitMgr()
+    : tablet_id_(200001),
+      rowkey_(),
+      key_(&rowkey_),
+      row_hash_(0)
+  {
+    obj_.set_int(1);
+    rowkey_.assign(&obj_, 1);
+  }
+
+  virtual void SetUp() override
+  {
+    // the request is reposted without registering to the deadlock detector,
+    // the row holder is set below as the deadlock detector would do
+    GCONF._lcl_op_interval.set_value("0ms");
+    ASSERT_EQ(OB_SUCCESS, mgr_.row_holder_mapper_.map_.init("LockWaitMgr", OB_SERVER_TENANT_ID));
+    mgr_.is_inited_ = true;
+    mgr_.stop_ = false;
+  }
+
+  virtual void TearDown() override
+  {
+    ObLockWaitMgr::clear_thread_node();
+    ObLockWaitMgr::get_thread_hold_key() = 0;
+  }
+
+  // the request of tx_id fails to lock the row held by holder and waits on it
+  void wait_on_row(ObLockWaitNode &node, const int64_t tx_id, const int64_t holder)
+  {
+    bool need_wait = false;
+    ObFunction<int(bool&, bool&)> rechecker = [](bool &locked, bool &wait_on_row) -> int {
+      locked = true;
+      wait_on_row = true;
+      return OB_SUCCESS;
+    };
+    mgr_.setup(node, ObTimeUtility::current_time());
+    ASSERT_EQ(OB_SUCCESS, mgr_.post_lock(OB_TRY_LOCK_ROW_CONFLICT, tablet_id_, rowkey_,
+                                         ObTimeUtility::current_time() + 10 * 1000 * 1000,
+                                         false, 0, 0, ObTransID(tx_id), ObTransID(holder),
+                                         rechecker));
+    ASSERT_TRUE(mgr_.post_process(true, need_wait));
+    ASSERT_TRUE(need_wait);
+    ObLockWaitMgr::clear_thread_node();
+    row_hash_ = node.hash();
+  }
+
+  // the statement of the waken up request ends without retrying
+  void end_stmt(ObLockWaitNode &node)
+  {
+    bool need_wait = false;
+    mgr_.setup(node, ObTimeUtility::current_time());
+    ASSERT_FALSE(mgr_.post_process(false, need_wait));
+    ObLockWaitMgr::clear_thread_node();
+  }
+
+  void make_hot_row()
+  {
+    mgr_.row_wait_cnt_[(row_hash_ >> 1) % ObLockWaitMgr::LOCK_BUCKET_COUNT] =
+        ObLockWaitMgr::HOT_ROW_WAIT_THRESHOLD;
+  }
+
+  void set_row_holder(const int64_t tx_id)
+  {
+    ASSERT_EQ(OB_SUCCESS, mgr_.row_holder_mapper_.map_.insert(ObIntWarp(row_hash_),
+                                                              ObTransID(tx_id)));
+  }
+
+  ObLockWaitNode *other(const ObLockWaitNode *node)
+  {
+    return node == &node1_ ? &node2_ : &node1_;
+  }
+
+protected:
+  static const int64_t HOLDER_TX = 100;
+  static const int64_t TX1 = 101;
+  static const int64_t TX2 = 102;
+  MockLockWaitMgr mgr_;
+  ObTabletID tablet_id_;
+  ObObj obj_;
+  ObStoreRowkey rowkey_;
+  ObMemtableKey key_;
+  uint64_t row_hash_;
+  ObLockWaitNode node1_;
+  ObLockWaitNode node2_;
+};
+
+TEST_F(TestLockWaitMgr, hot_row_holder_skip_followed_by_release)
+{
+  wait_on_row(node1_, TX1, HOLDER_TX);
+  wait_on_row(node2_, TX2, HOLDER_TX);
+  ASSERT_EQ(0, mgr_.reposted_.count());
+
+  // the holder commits, one waiter is waken up
+  mgr_.wakeup(tablet_id_, key_);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+  ObLockWaitNode *first = mgr_.reposted_.at(0);
+  ObLockWaitNode *second = other(first);
+  ASSERT_EQ(row_hash_, first->hold_key_);
+
+  // it locks the hot row and ends the statement, the wakeup is skipped
+  make_hot_row();
+  set_row_holder(first->tx_id_);
+  end_stmt(*first);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+
+  // and the next waiter is waken up when it releases the row lock
+  mgr_.wakeup(tablet_id_, key_);
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  ASSERT_EQ(second, mgr_.reposted_.at(1));
+}
+
+TEST_F(TestLockWaitMgr, hot_row_holder_skip_followed_by_rollback)
+{
+  wait_on_row(node1_, TX1, HOLDER_TX);
+  wait_on_row(node2_, TX2, HOLDER_TX);
+  mgr_.wakeup(tablet_id_, key_);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+  ObLockWaitNode *first = mgr_.reposted_.at(0);
+  ObLockWaitNode *second = other(first);
+
+  make_hot_row();
+  set_row_holder(first->tx_id_);
+  end_stmt(*first);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+
+  // the statement holding the row lock rolls back, the waiter is moved to the
+  // transaction and waken up when the transaction ends
+  ASSERT_EQ(OB_SUCCESS, mgr_.transform_row_lock_to_tx_lock(tablet_id_, key_,
+                                                           ObTransID(first->tx_id_),
+                                                           ObAddr()));
+  ASSERT_EQ(1, mgr_.reposted_.count());
+  mgr_.wakeup(ObTransID(first->tx_id_));
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  ASSERT_EQ(second, mgr_.reposted_.at(1));
+}
+
+TEST_F(TestLockWaitMgr, wakeup_on_stmt_end)
+{
+  // not a hot row
+  wait_on_row(node1_, TX1, HOLDER_TX);
+  wait_on_row(node2_, TX2, HOLDER_TX);
+  mgr_.wakeup(tablet_id_, key_);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+  ObLockWaitNode *first = mgr_.reposted_.at(0);
+  set_row_holder(first->tx_id_);
+  end_stmt(*first);
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  ASSERT_EQ(other(first), mgr_.reposted_.at(1));
+
+  // a hot row which is not held by the finished request
+  mgr_.reposted_.reset();
+  mgr_.row_holder_mapper_.clear();
+  wait_on_row(node1_, TX1, HOLDER_TX);
+  wait_on_row(node2_, TX2, HOLDER_TX);
+  mgr_.wakeup(tablet_id_, key_);
+  ASSERT_EQ(1, mgr_.reposted_.count());
+  first = mgr_.reposted_.at(0);
+  make_hot_row();
+  set_row_holder(HOLDER_TX);
+  end_stmt(*first);
+  ASSERT_EQ(2, mgr_.reposted_.count());
+  ASSERT_EQ(other(first), mgr_.reposted_.at(1));
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  const char *log_file_name = "test_lock_wait_mgr.log";
+  system("rm -rf test_lock_wait_mgr.log*");
+  OB_LOGGER.set_file_name(log_file_name, true, false, log_file_name, log_file_name);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
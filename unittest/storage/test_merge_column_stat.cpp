@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+
+#include "share/schema/ob_column_schema.h"
+#include "storage/ob_storage_schema.h"
+#include "storage/compaction/ob_merge_column_stat.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+using namespace compaction;
+using namespace blocksstable;
+
+namespace unittest
+{
+class TestMergeColumnStat : public ::testing::Test
+{
+public:
+  TestMergeColumnStat() : allocator_(ObModIds::TEST) {}
+  virtual ~TestMergeColumnStat() {}
+  virtual void SetUp();
+  virtual void TearDown() { storage_schema_.reset(); }
+
+  void prepare_schema(share::schema::ObTableSchema &table_schema);
+  // rowkey: c0 = i, c1 = i % 10
+  // c2: varchar of i % 5, null for i % 4 == 0
+  // c3: int of 1000 + i
+  // c4: longtext, not collected
+  void fill_row(const int64_t i, ObDatumRow &row);
+  void collect_rows(const int64_t start, const int64_t end, ObMergeColumnStat &stat);
+
+  static const int64_t TENANT_ID = 1;
+  static const int64_t TABLE_ID = 7777;
+  static const int64_t TEST_ROWKEY_COLUMN_CNT = 2;
+  static const int64_t TEST_COLUMN_CNT = 5;
+  // rowkey columns, multi version columns and the other columns
+  static const int64_t STORE_COLUMN_CNT = TEST_COLUMN_CNT + 2;
+  // c0, c1, c2, c3
+  static const int64_t STAT_COLUMN_CNT = 4;
+
+  common::ObArenaAllocator allocator_;
+  ObStorageSchema storage_schema_;
+  char str_buf_[5][8];
+};
+
+void TestMergeColumnStat::SetUp()
+{
+  share::schema::ObTableSchema table_schema;
+  prepare_schema(table_schema);
+  ASSERT_EQ(OB_SUCCESS, storage_schema_.init(allocator_, table_schema, lib::Worker::CompatMode::MYSQL));
+  for (int64_t i = 0; i < 5; ++i) {
+    snprintf(str_buf_[i], sizeof(str_buf_[i]), "v%ld", i);
+  }
+}
+
+void TestMergeColumnStat::prepare_schema(share::schema::ObTableSchema &table_schema)
+{
+  share::schema::ObColumnSchemaV2 column;
+  table_schema.reset();
+  ASSERT_EQ(OB_SUCCESS, table_schema.set_table_name("test_merge_column_stat"));
+  table_schema.set_tenant_id(TENANT_ID);
+  table_schema.set_tablegroup_id(1);
+  table_schema.set_database_id(1);
+  table_schema.set_table_id(TABLE_ID);
+  table_schema.set_rowkey_column_num(TEST_ROWKEY_COLUMN_CNT);
+  table_schema.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + TEST_COLUMN_CNT);
+  table_schema.set_block_size(16 * 1024);
+  table_schema.set_compress_func_name("none");
+  table_schema.set_row_store_type(FLAT_ROW_STORE);
+  char name[OB_MAX_FILE_NAME_LENGTH];
+  memset(name, 0, sizeof(name));
+  const ObObjType types[TEST_COLUMN_CNT] = {ObIntType, ObIntType, ObVarcharType, ObIntType, ObLongTextType};
+  for (int64_t i = 0; i < TEST_COLUMN_CNT; ++i) {
+    column.reset();
+    column.set_table_id(TABLE_ID);
+    column.set_column_id(OB_APP_MIN_COLUMN_ID + i);
+    sprintf(name, "c%ld", i);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(name));
+    column.set_data_type(types[i]);
+    column.set_collation_type(ObIntType == types[i] ? CS_TYPE_BINARY : CS_TYPE_UTF8MB4_GENERAL_CI);
+    column.set_data_length(10);
+    column.set_rowkey_position(i < TEST_ROWKEY_COLUMN_CNT ? i + 1 : 0);
+    ASSERT_EQ(OB_SUCCESS, table_schema.add_column(column));
+  }
+}
+
+void TestMergeColumnStat::fill_row(const int64_t i, ObDatumRow &row)
+{
+  row.storage_datums_[0].set_int(i);
+  row.storage_datums_[1].set_int(i % 10);
+  // multi version columns
+  row.storage_datums_[2].set_int(-100);
+  row.storage_datums_[3].set_int(0);
+  if (0 == i % 4) {
+    row.storage_datums_[4].set_null();
+  } else {
+    row.storage_datums_[4].set_string(str_buf_[i % 5], static_cast<int64_t>(strlen(str_buf_[i % 5])));
+  }
+  row.storage_datums_[5].set_int(1000 + i);
+  row.storage_datums_[6].set_null();
+}
+
+void TestMergeColumnStat::collect_rows(const int64_t start, const int64_t end, ObMergeColumnStat &stat)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, STORE_COLUMN_CNT));
+  for (int64_t i = start; i < end; ++i) {
+    row.reuse();
+    fill_row(i, row);
+    ASSERT_EQ(OB_SUCCESS, stat.collect(row));
+  }
+}
+
+TEST_F(TestMergeColumnStat, init)
+{
+  ObMergeColumnStat stat(allocator_);
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, STORE_COLUMN_CNT));
+  fill_row(0, row);
+  ASSERT_EQ(OB_NOT_INIT, stat.collect(row));
+
+  ASSERT_EQ(OB_SUCCESS, stat.init(storage_schema_));
+  ASSERT_TRUE(stat.is_inited());
+  ASSERT_EQ(OB_INIT_TWICE, stat.init(storage_schema_));
+  ASSERT_EQ(STORE_COLUMN_CNT, stat.store_column_cnt_);
+  // multi version columns and lob columns are skipped
+  ASSERT_EQ(STAT_COLUMN_CNT, stat.columns_.count());
+  const int64_t store_idxs[STAT_COLUMN_CNT] = {0, 1, 4, 5};
+  for (int64_t i = 0; i < STAT_COLUMN_CNT; ++i) {
+    ASSERT_EQ(store_idxs[i], stat.columns_.at(i).store_idx_);
+    ASSERT_NE(nullptr, stat.columns_.at(i).stat_);
+  }
+
+  stat.reset();
+  ASSERT_FALSE(stat.is_inited());
+  ASSERT_EQ(0, stat.columns_.count());
+}
+
+TEST_F(TestMergeColumnStat, collect)
+{
+  ObMergeColumnStat stat(allocator_);
+  ASSERT_EQ(OB_SUCCESS, stat.init(storage_schema_));
+  collect_rows(0, 100, stat);
+  ASSERT_EQ(100, stat.row_count_);
+  ASSERT_GT(stat.total_row_len_, 0);
+
+  const ObColumnStat &c0 = *stat.columns_.at(0).stat_;
+  ASSERT_EQ(0, c0.get_num_null());
+  ASSERT_EQ(0, c0.get_min_value().get_int());
+  ASSERT_EQ(99, c0.get_max_value().get_int());
+  ASSERT_EQ(100 * static_cast<int64_t>(sizeof(int64_t)), stat.columns_.at(0).total_len_);
+
+  const ObColumnStat &c2 = *stat.columns_.at(2).stat_;
+  ASSERT_EQ(25, c2.get_num_null());
+  ASSERT_EQ(ObString("v0"), c2.get_min_value().get_string());
+  ASSERT_EQ(ObString("v4"), c2.get_max_value().get_string());
+  ASSERT_EQ(75 * 2, stat.columns_.at(2).total_len_);
+
+  ASSERT_EQ(OB_SUCCESS, stat.columns_.at(0).stat_->finish());
+  ASSERT_EQ(OB_SUCCESS, stat.columns_.at(1).stat_->finish());
+  ASSERT_EQ(OB_SUCCESS, stat.columns_.at(2).stat_->finish());
+  // llc estimation is exact enough for small ndv
+  ASSERT_NEAR(100, stat.columns_.at(0).stat_->get_num_distinct(), 5);
+  ASSERT_NEAR(10, stat.columns_.at(1).stat_->get_num_distinct(), 1);
+  ASSERT_NEAR(5, stat.columns_.at(2).stat_->get_num_distinct(), 1);
+
+  // row of other schema
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, STORE_COLUMN_CNT - 1));
+  ASSERT_EQ(OB_ERR_UNEXPECTED, stat.collect(row));
+  ASSERT_EQ(100, stat.row_count_);
+}
+
+TEST_F(TestMergeColumnStat, merge)
+{
+  ObMergeColumnStat tablet_stat(allocator_);
+  ObMergeColumnStat task_stat1(allocator_);
+  ObMergeColumnStat task_stat2(allocator_);
+  ObMergeColumnStat not_inited(allocator_);
+  ASSERT_EQ(OB_SUCCESS, tablet_stat.init(storage_schema_));
+  ASSERT_EQ(OB_SUCCESS, task_stat1.init(storage_schema_));
+  ASSERT_EQ(OB_SUCCESS, task_stat2.init(storage_schema_));
+  ASSERT_EQ(OB_NOT_INIT, tablet_stat.merge(not_inited));
+
+  // two parallel merge tasks of adjacent ranges
+  collect_rows(0, 100, task_stat1);
+  collect_rows(100, 300, task_stat2);
+  ASSERT_EQ(OB_SUCCESS, tablet_stat.merge(task_stat1));
+  ASSERT_EQ(OB_SUCCESS, tablet_stat.merge(task_stat2));
+  ASSERT_EQ(300, tablet_stat.row_count_);
+  ASSERT_EQ(task_stat1.total_row_len_ + task_stat2.total_row_len_, tablet_stat.total_row_len_);
+
+  const ObColumnStat &c0 = *tablet_stat.columns_.at(0).stat_;
+  ASSERT_EQ(0, c0.get_min_value().get_int());
+  ASSERT_EQ(299, c0.get_max_value().get_int());
+  const ObColumnStat &c2 = *tablet_stat.columns_.at(2).stat_;
+  ASSERT_EQ(75, c2.get_num_null());
+  const ObColumnStat &c3 = *tablet_stat.columns_.at(3).stat_;
+  ASSERT_EQ(1000, c3.get_min_value().get_int());
+  ASSERT_EQ(1299, c3.get_max_value().get_int());
+
+  // ndv of merged llc bitmap is the ndv of the union
+  ASSERT_EQ(OB_SUCCESS, tablet_stat.columns_.at(0).stat_->finish());
+  ASSERT_EQ(OB_SUCCESS, tablet_stat.columns_.at(1).stat_->finish());
+  ASSERT_NEAR(300, tablet_stat.columns_.at(0).stat_->get_num_distinct(), 15);
+  ASSERT_NEAR(10, tablet_stat.columns_.at(1).stat_->get_num_distinct(), 1);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_merge_column_stat.log*");
+  OB_LOGGER.set_file_name("test_merge_column_stat.log");
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
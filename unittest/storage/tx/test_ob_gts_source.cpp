@@ -0,0 +1,310 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define private public
+#include "storage/tx/ob_gts_source.h"
+#undef private
+#include <gtest/gtest.h>
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/net/ob_addr.h"
+#include "storage/tx/ob_gts_rpc.h"
+#include "storage/tx/ob_gts_msg.h"
+#include "storage/tx/ob_location_adapter.h"
+#include "storage/tx/ob_ts_mgr.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace transaction;
+namespace unittest
+{
+
+class MockGtsRequestRpc : public ObIGtsRequestRpc
+{
+public:
+  MockGtsRequestRpc() : post_ret_(OB_SUCCESS), post_cnt_(0), last_srr_() {}
+  ~MockGtsRequestRpc() {}
+  int start() { return OB_SUCCESS; }
+  int stop() { return OB_SUCCESS; }
+  int wait() { return OB_SUCCESS; }
+  void destroy() {}
+public:
+  int post(const uint64_t tenant_id, const ObAddr &server, const ObGtsRequest &msg)
+  {
+    UNUSED(tenant_id);
+    UNUSED(server);
+    ++post_cnt_;
+    if (OB_SUCCESS == post_ret_) {
+      last_srr_ = msg.get_srr();
+    }
+    return post_ret_;
+  }
+public:
+  int post_ret_;
+  int64_t post_cnt_;
+  MonotonicTs last_srr_;
+};
+
+class MockLocationAdapter : public ObILocationAdapter
+{
+public:
+  MockLocationAdapter(const ObAddr &leader) : leader_(leader) {}
+  ~MockLocationAdapter() {}
+  int init(share::schema::ObMultiVersionSchemaService *schema_service,
+           share::ObLocationService *location_service)
+  {
+    UNUSED(schema_service);
+    UNUSED(location_service);
+    return OB_SUCCESS;
+  }
+  void destroy() {}
+public:
+  int nonblock_get_leader(const int64_t cluster_id, const int64_t tenant_id, const ObLSID &ls_id,
+                          ObAddr &leader)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    leader = leader_;
+    return OB_SUCCESS;
+  }
+  int nonblock_renew(const int64_t cluster_id, const int64_t tenant_id, const ObLSID &ls_id)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    return OB_SUCCESS;
+  }
+  int nonblock_get(const int64_t cluster_id, const int64_t tenant_id, const ObLSID &ls_id,
+                   ObLSLocation &location)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    UNUSED(location);
+    return OB_NOT_SUPPORTED;
+  }
+private:
+  ObAddr leader_;
+};
+
+class MockTsCbTask : public ObTsCbTask
+{
+public:
+  MockTsCbTask(const uint64_t tenant_id, const MonotonicTs stc) : tenant_id_(tenant_id), stc_(stc) {}
+  ~MockTsCbTask() {}
+  int gts_callback_interrupted(const int errcode) { UNUSED(errcode); return OB_SUCCESS; }
+  int get_gts_callback(const MonotonicTs srr, const SCN &gts, const MonotonicTs receive_gts_ts)
+  {
+    UNUSED(srr);
+    UNUSED(gts);
+    UNUSED(receive_gts_ts);
+    return OB_SUCCESS;
+  }
+  int gts_elapse_callback(const MonotonicTs srr, const SCN &gts)
+  {
+    UNUSED(srr);
+    UNUSED(gts);
+    return OB_SUCCESS;
+  }
+  MonotonicTs get_stc() const { return stc_; }
+  uint64_t hash() const { return 0; }
+  uint64_t get_tenant_id() const { return tenant_id_; }
+private:
+  uint64_t tenant_id_;
+  MonotonicTs stc_;
+};
+
+class TestObGtsSource : public ::testing::Test
+{
+public :
+  TestObGtsSource()
+    : server_(ObAddr::IPV4, "10.0.0.1", 10000),
+      leader_(ObAddr::IPV4, "10.0.0.2", 10000),
+      location_adapter_(leader_) {}
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, gts_source_.init(TENANT_ID, server_, &rpc_, &location_adapter_));
+  }
+  virtual void TearDown() { gts_source_.destroy(); }
+  // a stc later than the srr of all rpcs sent before
+  MonotonicTs next_stc()
+  {
+    usleep(10);
+    return MonotonicTs::current_time();
+  }
+  // the response of the latest rpc arrives, with a round trip time of RPC_RT
+  int respond()
+  {
+    bool update = false;
+    const MonotonicTs srr = rpc_.last_srr_;
+    return gts_source_.update_gts(srr, ObTimeUtility::current_time_ns(),
+                                  MonotonicTs(srr.mts_ + RPC_RT), update);
+  }
+  // send one rpc and receive its response, so the coalescing window is 2 * RPC_RT
+  void warm_up()
+  {
+    int64_t gts = 0;
+    MonotonicTs receive_gts_ts;
+    ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(next_stc(), NULL, gts, receive_gts_ts));
+    ASSERT_EQ(1, rpc_.post_cnt_);
+    ASSERT_EQ(OB_SUCCESS, respond());
+    ASSERT_EQ(1, rpc_.post_cnt_);
+    ASSERT_EQ(RPC_RT, gts_source_.gts_rpc_rt_);
+  }
+public:
+  static const uint64_t TENANT_ID = 1001;
+  static const int64_t RPC_RT = 4 * 1000;
+  ObAddr server_;
+  ObAddr leader_;
+  MockGtsRequestRpc rpc_;
+  MockLocationAdapter location_adapter_;
+  ObGtsSource gts_source_;
+};
+
+const uint64_t TestObGtsSource::TENANT_ID;
+const int64_t TestObGtsSource::RPC_RT;
+
+TEST_F(TestObGtsSource, coalesce_requests_during_inflight_rpc)
+{
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  warm_up();
+
+  MockTsCbTask task0(TENANT_ID, next_stc());
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(task0.get_stc(), &task0, gts, receive_gts_ts));
+  ASSERT_EQ(2, rpc_.post_cnt_);
+  const MonotonicTs inflight_srr = rpc_.last_srr_;
+
+  // requests arriving while the rpc is inflight wait in the queue without a rpc
+  MockTsCbTask task1(TENANT_ID, next_stc());
+  MockTsCbTask task2(TENANT_ID, next_stc());
+  MockTsCbTask task3(TENANT_ID, next_stc());
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(task1.get_stc(), &task1, gts, receive_gts_ts));
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(task2.get_stc(), &task2, gts, receive_gts_ts));
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(task3.get_stc(), &task3, gts, receive_gts_ts));
+  ASSERT_EQ(2, rpc_.post_cnt_);
+  ASSERT_EQ(4, gts_source_.get_task_count());
+  ASSERT_TRUE(gts_source_.has_deferred_query_);
+
+  // the response sends one rpc for all of them, whose srr is later than their stc
+  ASSERT_EQ(OB_SUCCESS, respond());
+  ASSERT_EQ(3, rpc_.post_cnt_);
+  ASSERT_FALSE(gts_source_.has_deferred_query_);
+  ASSERT_TRUE(rpc_.last_srr_ > inflight_srr);
+  ASSERT_TRUE(rpc_.last_srr_ >= task3.get_stc());
+
+  // nothing is deferred any more
+  ASSERT_EQ(OB_SUCCESS, respond());
+  ASSERT_EQ(3, rpc_.post_cnt_);
+  ASSERT_EQ(OB_SUCCESS, gts_source_.get_gts(task3.get_stc(), NULL, gts, receive_gts_ts));
+}
+
+TEST_F(TestObGtsSource, retry_after_inflight_rpc_timeout)
+{
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  warm_up();
+
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(next_stc(), NULL, gts, receive_gts_ts));
+  ASSERT_EQ(2, rpc_.post_cnt_);
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(next_stc(), NULL, gts, receive_gts_ts));
+  ASSERT_EQ(2, rpc_.post_cnt_);
+  ASSERT_TRUE(gts_source_.has_deferred_query_);
+
+  // the response does not arrive within the window, the rpc is regarded as lost
+  usleep(2 * ObGtsSource::MAX_GTS_COALESCE_WINDOW_US);
+  const MonotonicTs stc = next_stc();
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(stc, NULL, gts, receive_gts_ts));
+  ASSERT_EQ(3, rpc_.post_cnt_);
+  ASSERT_TRUE(rpc_.last_srr_ >= stc);
+
+  // the response of the retry serves the deferred requests as well, the flag
+  // left by them costs one more rpc at most
+  ASSERT_EQ(OB_SUCCESS, respond());
+  ASSERT_EQ(OB_SUCCESS, gts_source_.get_gts(stc, NULL, gts, receive_gts_ts));
+  ASSERT_FALSE(gts_source_.has_deferred_query_);
+  ASSERT_EQ(4, rpc_.post_cnt_);
+  ASSERT_EQ(OB_SUCCESS, respond());
+  ASSERT_EQ(4, rpc_.post_cnt_);
+}
+
+TEST_F(TestObGtsSource, retry_after_post_failed)
+{
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  warm_up();
+
+  // a rpc failed to post is not inflight, the next request is not deferred
+  rpc_.post_ret_ = OB_TIMEOUT;
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(next_stc(), NULL, gts, receive_gts_ts));
+  ASSERT_EQ(2, rpc_.post_cnt_);
+  rpc_.post_ret_ = OB_SUCCESS;
+  const MonotonicTs stc = next_stc();
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(stc, NULL, gts, receive_gts_ts));
+  ASSERT_EQ(3, rpc_.post_cnt_);
+  ASSERT_FALSE(gts_source_.has_deferred_query_);
+  ASSERT_TRUE(rpc_.last_srr_ >= stc);
+
+  ASSERT_EQ(OB_SUCCESS, respond());
+  ASSERT_EQ(3, rpc_.post_cnt_);
+  ASSERT_EQ(OB_SUCCESS, gts_source_.get_gts(stc, NULL, gts, receive_gts_ts));
+}
+
+TEST_F(TestObGtsSource, retry_after_err_response)
+{
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  warm_up();
+
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(next_stc(), NULL, gts, receive_gts_ts));
+  ASSERT_EQ(2, rpc_.post_cnt_);
+  const MonotonicTs stc = next_stc();
+  ASSERT_EQ(OB_EAGAIN, gts_source_.get_gts(stc, NULL, gts, receive_gts_ts));
+  ASSERT_EQ(2, rpc_.post_cnt_);
+  ASSERT_TRUE(gts_source_.has_deferred_query_);
+
+  // the leader fails the inflight rpc, the deferred requests are sent at once
+  ObGtsErrResponse err_msg;
+  ASSERT_EQ(OB_SUCCESS, err_msg.init(TENANT_ID, rpc_.last_srr_, OB_NOT_MASTER, leader_));
+  ASSERT_EQ(OB_SUCCESS, gts_source_.handle_gts_err_response(err_msg));
+  ASSERT_EQ(3, rpc_.post_cnt_);
+  ASSERT_FALSE(gts_source_.has_deferred_query_);
+  ASSERT_TRUE(rpc_.last_srr_ >= stc);
+
+  // an err response of an older rpc does not resend anything
+  ASSERT_EQ(OB_SUCCESS, gts_source_.handle_gts_err_response(err_msg));
+  ASSERT_EQ(3, rpc_.post_cnt_);
+
+  ASSERT_EQ(OB_SUCCESS, respond());
+  ASSERT_EQ(3, rpc_.post_cnt_);
+  ASSERT_EQ(OB_SUCCESS, gts_source_.get_gts(stc, NULL, gts, receive_gts_ts));
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_source.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}